@@ -11,9 +11,16 @@ import 'package:flutter/services.dart';
 import 'package:flutter/widgets.dart';
 import 'package:stream_transform/stream_transform.dart';
 
+import 'src/burst_capture_events.dart';
+import 'src/camera_statistics.dart';
+import 'src/frame_processor_result.dart';
 import 'src/type_conversion.dart';
 import 'src/utils.dart';
 
+export 'src/burst_capture_events.dart';
+export 'src/camera_statistics.dart';
+export 'src/frame_processor_result.dart';
+
 const MethodChannel _channel = MethodChannel('plugins.flutter.io/camera_tizen');
 
 /// A Tizen implementation of [CameraPlatform].
@@ -53,6 +60,23 @@ class CameraTizen extends CameraPlatform {
     return StreamController<DeviceEvent>.broadcast();
   }
 
+  /// The maximum number of frames per second delivered by
+  /// [onStreamedFrameAvailable], or null for the preview frame rate.
+  ///
+  /// Takes effect when the next image stream starts.
+  int? maxImageStreamFrameRate;
+
+  /// Whether [takePicture] returns the captured JPEG in memory instead of
+  /// writing it to a file.
+  bool captureToMemory = false;
+
+  /// Whether [takePicture] waits for the captured file to be flushed to
+  /// storage before it completes.
+  ///
+  /// Syncing protects the file against a power loss at the cost of
+  /// shot-to-shot latency.
+  bool syncCapturedFiles = false;
+
   // The stream to receive frames from the native code.
   StreamSubscription<dynamic>? _platformImageStreamSubscription;
 
@@ -222,19 +246,26 @@ class CameraTizen extends CameraPlatform {
 
   @override
   Future<XFile> takePicture(int cameraId) async {
-    final String? path = await _channel.invokeMethod<String>(
+    final Object? picture = await _channel.invokeMethod<Object>(
       'takePicture',
-      <String, dynamic>{'cameraId': cameraId},
+      <String, dynamic>{
+        'cameraId': cameraId,
+        'inMemory': captureToMemory,
+        'syncFile': syncCapturedFiles,
+      },
     );
 
-    if (path == null) {
+    if (picture is Uint8List) {
+      return XFile.fromData(picture, mimeType: 'image/jpeg');
+    }
+    if (picture is! String) {
       throw CameraException(
         'INVALID_PATH',
         'The platform "$defaultTargetPlatform" did not return a path while reporting success. The platform should always return a valid path or report an error.',
       );
     }
 
-    return XFile(path);
+    return XFile(picture);
   }
 
   @override
@@ -300,7 +331,9 @@ class CameraTizen extends CameraPlatform {
   }
 
   Future<void> _startPlatformStream() async {
-    await _channel.invokeMethod<void>('startImageStream');
+    await _channel.invokeMethod<void>('startImageStream', <String, dynamic>{
+      'maxFrameRate': maxImageStreamFrameRate,
+    });
     const EventChannel cameraEventChannel = EventChannel(
       'plugins.flutter.io/camera_tizen/imageStream',
     );
@@ -309,6 +342,9 @@ class CameraTizen extends CameraPlatform {
       _frameStreamController!.add(
         cameraImageFromPlatformData(imageData as Map<dynamic, dynamic>),
       );
+      // The next frame is only sent after this one is acknowledged. Frames
+      // captured in the meantime are dropped in favor of the latest one.
+      _channel.invokeMethod<void>('receivedImageStreamData');
     });
   }
 
@@ -319,6 +355,88 @@ class CameraTizen extends CameraPlatform {
     _frameStreamController = null;
   }
 
+  /// Returns the results sent by native frame processors.
+  ///
+  /// Frame processors are added by other native plugins with
+  /// `CameraPluginAddFrameProcessor`, declared in
+  /// `tizen/inc/camera_frame_processor.h`. They analyze every preview frame
+  /// on the camera thread, so that frames do not cross a platform channel.
+  Stream<FrameProcessorResult> onFrameProcessorResult() {
+    const EventChannel resultChannel = EventChannel(
+      'plugins.flutter.io/camera_tizen/frameProcessorResults',
+    );
+    return resultChannel.receiveBroadcastStream().map(
+          (dynamic event) => FrameProcessorResult.fromPlatformData(
+            event as Map<dynamic, dynamic>,
+          ),
+        );
+  }
+
+  /// Starts taking [count] pictures, or pictures until [stopBurstCapture] is
+  /// called if [count] is null, no more often than once per [interval].
+  ///
+  /// Pictures are taken with the continuous capture of the camera if it is
+  /// supported, and written to files in the background. Each file is
+  /// reported by [onBurstImage] as soon as it has been written, and
+  /// [onBurstCompleted] fires after the last one.
+  Future<void> startBurstCapture(
+    int cameraId, {
+    int? count,
+    Duration interval = Duration.zero,
+  }) =>
+      _channel.invokeMethod<void>('startBurstCapture', <String, dynamic>{
+        'cameraId': cameraId,
+        'count': count ?? 0,
+        'interval': interval.inMilliseconds,
+        'syncFile': syncCapturedFiles,
+      });
+
+  /// Stops the burst capture started by [startBurstCapture].
+  Future<void> stopBurstCapture(int cameraId) =>
+      _channel.invokeMethod<void>('stopBurstCapture', <String, dynamic>{
+        'cameraId': cameraId,
+      });
+
+  /// The pictures taken by a burst capture.
+  Stream<BurstImageEvent> onBurstImage(int cameraId) {
+    return _cameraEvents(cameraId).whereType<BurstImageEvent>();
+  }
+
+  /// The end of burst captures.
+  Stream<BurstCompletedEvent> onBurstCompleted(int cameraId) {
+    return _cameraEvents(cameraId).whereType<BurstCompletedEvent>();
+  }
+
+  /// Switches the camera [cameraId] to the camera of [description] in place.
+  ///
+  /// Unlike disposing the camera and creating a new one, the camera keeps
+  /// its id and preview texture, and the texture shows the last frame of the
+  /// previous camera until the new one starts. Returns the new preview size.
+  Future<Size> switchCamera(int cameraId, CameraDescription description) async {
+    final Map<String, dynamic>? reply =
+        await _channel.invokeMapMethod<String, dynamic>(
+      'switchCamera',
+      <String, dynamic>{
+        'cameraId': cameraId,
+        'cameraName': description.name,
+      },
+    );
+    return Size(
+      reply!['previewWidth']! as double,
+      reply['previewHeight']! as double,
+    );
+  }
+
+  /// Returns the preview and capture performance counters of a camera.
+  Future<CameraStatistics> getStatistics(int cameraId) async {
+    final Map<dynamic, dynamic>? statistics =
+        await _channel.invokeMapMethod<dynamic, dynamic>(
+      'getStatistics',
+      <String, dynamic>{'cameraId': cameraId},
+    );
+    return CameraStatistics.fromPlatformData(statistics!);
+  }
+
   void _onFrameStreamPauseResume() {
     throw CameraException(
       'InvalidCall',
@@ -563,6 +681,20 @@ class CameraTizen extends CameraPlatform {
                 : null,
           ),
         );
+      case 'burst_image':
+        final Map<String, Object?> arguments = _getArgumentDictionary(call);
+        _cameraEventStreamController.add(
+          BurstImageEvent(
+            cameraId,
+            arguments['index']! as int,
+            XFile(arguments['path']! as String),
+          ),
+        );
+      case 'burst_completed':
+        final Map<String, Object?> arguments = _getArgumentDictionary(call);
+        _cameraEventStreamController.add(
+          BurstCompletedEvent(cameraId, arguments['count']! as int),
+        );
       case 'error':
         final Map<String, Object?> arguments = _getArgumentDictionary(call);
         _cameraEventStreamController.add(
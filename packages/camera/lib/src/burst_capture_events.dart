@@ -0,0 +1,27 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'package:camera_platform_interface/camera_platform_interface.dart';
+
+/// An event fired when a picture of a burst capture has been written.
+class BurstImageEvent extends CameraEvent {
+  /// Creates a [BurstImageEvent].
+  const BurstImageEvent(super.cameraId, this.index, this.file);
+
+  /// The position of the picture in the burst, starting at 0.
+  final int index;
+
+  /// The file the picture has been written to.
+  final XFile file;
+}
+
+/// An event fired when a burst capture has ended and every picture of it has
+/// been reported.
+class BurstCompletedEvent extends CameraEvent {
+  /// Creates a [BurstCompletedEvent].
+  const BurstCompletedEvent(super.cameraId, this.count);
+
+  /// The number of pictures taken.
+  final int count;
+}
@@ -0,0 +1,78 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+/// Preview and capture performance counters of a camera.
+///
+/// Counts accumulate from the time the camera is created.
+class CameraStatistics {
+  /// Creates a [CameraStatistics].
+  const CameraStatistics({
+    required this.framesReceived,
+    required this.framesPresented,
+    required this.framesDropped,
+    required this.fps,
+    required this.latencyP50,
+    required this.latencyP90,
+    required this.latencyP99,
+    required this.captures,
+    required this.lastCaptureTime,
+    required this.averageCaptureTime,
+    required this.lastPictureTime,
+  });
+
+  /// Creates a [CameraStatistics] from a map sent by the platform.
+  factory CameraStatistics.fromPlatformData(Map<dynamic, dynamic> data) {
+    Duration milliseconds(String key) =>
+        Duration(microseconds: ((data[key]! as double) * 1000).round());
+    return CameraStatistics(
+      framesReceived: data['framesReceived']! as int,
+      framesPresented: data['framesPresented']! as int,
+      framesDropped: data['framesDropped']! as int,
+      fps: data['fps']! as double,
+      latencyP50: milliseconds('latencyP50'),
+      latencyP90: milliseconds('latencyP90'),
+      latencyP99: milliseconds('latencyP99'),
+      captures: data['captures']! as int,
+      lastCaptureTime: milliseconds('lastCaptureTime'),
+      averageCaptureTime: milliseconds('averageCaptureTime'),
+      lastPictureTime: milliseconds('lastPictureTime'),
+    );
+  }
+
+  /// The number of preview frames delivered by the camera.
+  final int framesReceived;
+
+  /// The number of preview frames drawn to the texture.
+  final int framesPresented;
+
+  /// The number of preview frames replaced before they could be drawn.
+  final int framesDropped;
+
+  /// The preview frame rate over the latest frames, or 0 if the preview has
+  /// stalled for a second.
+  final double fps;
+
+  /// The median time from a preview frame's delivery to its drawing, over
+  /// the latest 256 presented frames.
+  final Duration latencyP50;
+
+  /// The 90th percentile of the preview latency.
+  final Duration latencyP90;
+
+  /// The 99th percentile of the preview latency.
+  final Duration latencyP99;
+
+  /// The number of pictures taken with `takePicture`.
+  final int captures;
+
+  /// The time from the latest picture request to its capture completion.
+  final Duration lastCaptureTime;
+
+  /// The average time from a picture request to its capture completion.
+  final Duration averageCaptureTime;
+
+  /// The time from the latest picture request to its result, including the
+  /// time to write the file.
+  final Duration lastPictureTime;
+}
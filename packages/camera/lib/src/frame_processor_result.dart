@@ -0,0 +1,25 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+import 'dart:typed_data';
+
+/// A result sent by a native frame processor.
+class FrameProcessorResult {
+  /// Creates a [FrameProcessorResult].
+  const FrameProcessorResult(this.processor, this.data);
+
+  /// Creates a [FrameProcessorResult] from an event sent by the platform.
+  factory FrameProcessorResult.fromPlatformData(Map<dynamic, dynamic> data) {
+    return FrameProcessorResult(
+      data['name']! as String,
+      data['data']! as Uint8List,
+    );
+  }
+
+  /// The name the frame processor was added with.
+  final String processor;
+
+  /// The result, in a format defined by the frame processor.
+  final Uint8List data;
+}
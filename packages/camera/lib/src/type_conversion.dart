@@ -32,6 +32,7 @@ CameraImageFormat _cameraImageFormatFromPlatformData(dynamic data) {
 
 ImageFormatGroup _imageFormatGroupFromPlatformData(dynamic data) {
   switch (data) {
+    case 0: // CAMERA_PIXEL_FORMAT_NV12
     case 7: // CAMERA_PIXEL_FORMAT_I420
       return ImageFormatGroup.yuv420;
     case 13: // CAMERA_PIXEL_FORMAT_JPEG
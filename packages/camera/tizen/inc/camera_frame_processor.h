@@ -0,0 +1,75 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_CAMERA_FRAME_PROCESSOR_H_
+#define FLUTTER_PLUGIN_CAMERA_FRAME_PROCESSOR_H_
+
+#include <media_packet.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "camera_plugin.h"
+
+// An interface for other native plugins to analyze camera preview frames
+// without passing them through a platform channel. Only the results, which
+// are usually small, are sent to Dart.
+
+#define CAMERA_FRAME_MAX_PLANES 4
+
+typedef struct {
+  // The first byte of the plane. Rows are |bytes_per_row| bytes apart.
+  const uint8_t *data;
+  // The number of bytes that can be read from |data|.
+  size_t size;
+  int bytes_per_row;
+  int bytes_per_pixel;
+  int width;
+  int height;
+} CameraFramePlane;
+
+typedef struct {
+  // The preview packet the planes belong to.
+  media_packet_h packet;
+  // A camera_pixel_format_e value, CAMERA_PIXEL_FORMAT_I420 or
+  // CAMERA_PIXEL_FORMAT_NV12.
+  int format;
+  int width;
+  int height;
+  // The presentation timestamp in nanoseconds.
+  int64_t timestamp;
+  uint32_t plane_count;
+  CameraFramePlane planes[CAMERA_FRAME_MAX_PLANES];
+} CameraFrame;
+
+// Called on the camera thread for every preview frame. |frame| and the
+// memory it points to are only valid during the call, and the preview is
+// held until the call returns, so the callback must be fast.
+typedef void (*CameraFrameProcessorCallback)(const CameraFrame *frame,
+                                             void *user_data);
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// Adds a frame processor identified by |name|. Returns false if a processor
+// with the same name already exists.
+FLUTTER_PLUGIN_EXPORT bool CameraPluginAddFrameProcessor(
+    const char *name, CameraFrameProcessorCallback callback, void *user_data);
+
+// Removes the frame processor identified by |name|. The callback is not
+// called anymore once this returns. Must not be called from a frame processor
+// callback.
+FLUTTER_PLUGIN_EXPORT void CameraPluginRemoveFrameProcessor(const char *name);
+
+// Sends |size| bytes of |data| to Dart as a result of the frame processor
+// identified by |name|. Can be called on any thread.
+FLUTTER_PLUGIN_EXPORT void CameraPluginSendFrameProcessorResult(
+    const char *name, const uint8_t *data, size_t size);
+
+#if defined(__cplusplus)
+}  // extern "C"
+#endif
+
+#endif  // FLUTTER_PLUGIN_CAMERA_FRAME_PROCESSOR_H_
@@ -0,0 +1,24 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "camera_capabilities.h"
+
+CameraCapabilityCache &CameraCapabilityCache::GetInstance() {
+  static CameraCapabilityCache instance;
+  return instance;
+}
+
+const CameraCapabilities *CameraCapabilityCache::Find(
+    camera_device_e device) const {
+  auto iter = capabilities_.find(device);
+  if (iter == capabilities_.end()) {
+    return nullptr;
+  }
+  return &iter->second;
+}
+
+void CameraCapabilityCache::Add(camera_device_e device,
+                                CameraCapabilities capabilities) {
+  capabilities_[device] = std::move(capabilities);
+}
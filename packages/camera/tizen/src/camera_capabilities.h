@@ -0,0 +1,46 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_CAMERA_CAPABILITIES_H_
+#define FLUTTER_PLUGIN_CAMERA_CAPABILITIES_H_
+
+#include <camera.h>
+
+#include <map>
+#include <utility>
+#include <vector>
+
+// Properties of a camera device that do not change while the process runs.
+struct CameraCapabilities {
+  int lens_orientation = 0;
+  std::vector<std::pair<int, int>> capture_resolutions;
+  std::vector<std::pair<int, int>> preview_resolutions;
+  std::vector<std::pair<int, int>> recorder_resolutions;
+  // The zoom and exposure ranges are only valid if they are supported.
+  bool zoom_supported = false;
+  int min_zoom = 0;
+  int max_zoom = 0;
+  bool exposure_supported = false;
+  int min_exposure = 0;
+  int max_exposure = 0;
+  bool continuous_capture_supported = false;
+};
+
+// The capabilities of each camera device, discovered once and shared by
+// every camera created in the process. Only accessed on the platform thread.
+class CameraCapabilityCache {
+ public:
+  static CameraCapabilityCache &GetInstance();
+
+  // Returns nullptr if the capabilities of |device| are not known yet.
+  const CameraCapabilities *Find(camera_device_e device) const;
+  void Add(camera_device_e device, CameraCapabilities capabilities);
+
+ private:
+  CameraCapabilityCache() = default;
+
+  std::map<camera_device_e, CameraCapabilities> capabilities_;
+};
+
+#endif  // FLUTTER_PLUGIN_CAMERA_CAPABILITIES_H_
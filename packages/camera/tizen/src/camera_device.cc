@@ -6,10 +6,13 @@
 
 #include <app_common.h>
 #include <flutter/encodable_value.h>
+#include <glib.h>
 #include <sys/time.h>
 
+#include <algorithm>
 #include <cmath>
 
+#include "frame_processor_registry.h"
 #include "log.h"
 
 // These macros came from tizen camera_app
@@ -18,6 +21,10 @@
 
 namespace {
 
+// The number of pictures requested from the camera at once. A burst without
+// a count is continued with another batch when one completes.
+constexpr int kMaxContinuousCaptureCount = 100;
+
 uint64_t Timestamp() {
   struct timeval tv;
   gettimeofday(&tv, nullptr);
@@ -40,6 +47,23 @@ std::string CreateTempFileName(const std::string &prefix,
   return file_name;
 }
 
+// Runs |task| on the platform thread after |delay_ms| milliseconds.
+void PostTask(std::function<void()> task, guint delay_ms = 0) {
+  auto *param = new std::function<void()>(std::move(task));
+  GSourceFunc run = [](gpointer data) -> gboolean {
+    (*static_cast<std::function<void()> *>(data))();
+    return G_SOURCE_REMOVE;
+  };
+  GDestroyNotify destroy = [](gpointer data) {
+    delete static_cast<std::function<void()> *>(data);
+  };
+  if (delay_ms > 0) {
+    g_timeout_add_full(G_PRIORITY_DEFAULT, delay_ms, run, param, destroy);
+  } else {
+    g_idle_add_full(G_PRIORITY_DEFAULT, run, param, destroy);
+  }
+}
+
 ExifTagOrientation ChooseExifTagOrientatoin(OrientationType device_orientation,
                                             bool is_front_lens_facing) {
   ExifTagOrientation orientation = ExifTagOrientation::kTopLeft;
@@ -223,6 +247,8 @@ bool FocusModeToString(FocusMode focus_mode, std::string &mode) {
 }
 
 flutter::EncodableValue CameraDevice::GetAvailableCameras() {
+  // Not cached, since cameras such as USB cameras can be connected while the
+  // app runs.
   CameraDevice default_camera;
   int count = 0;
   default_camera.GetCameraDeviceCount(count);
@@ -270,11 +296,7 @@ CameraDevice::CameraDevice(flutter::PluginRegistrar *registrar,
   CreateRecorder();
 
   // Init camera
-  SetCameraExifTagEnable(true);
-  SetCameraAutoFocusMode(CameraAutoFocusMode::kNormal);
-  if (type == CameraDeviceType::kFront) {
-    SetCameraFlip(CameraFlip::kVertical);
-  }
+  ConfigureCamera();
 
   GetCameraPreviewResolution(preview_width_, preview_height_);
 
@@ -308,24 +330,7 @@ CameraDevice::CameraDevice(flutter::PluginRegistrar *registrar,
     }
   });
 
-  // Gather supported resolutions
-  ForeachCameraSupportedCaptureResolutions(
-      [this](int supported_width, int supported_height) -> bool {
-        LOG_DEBUG("supported camera capture resolution width[%d] height[%d]",
-                  supported_width, supported_height);
-        std::pair<int, int> resolution = {supported_width, supported_height};
-        supported_camera_resolutions_.emplace_back(resolution);
-        return true;
-      });
-  ForeachRecorderSupprotedVideoResolutions(
-      [this](int supported_width, int supported_height) -> bool {
-        LOG_DEBUG("supported recorder video resolution width[%d] height[%d]",
-                  supported_width, supported_height);
-        std::pair<int, int> resolution = {supported_width, supported_height};
-        supported_recorder_resolutions_.emplace_back(resolution);
-        return true;
-      });
-
+  LoadCapabilities();
   SetResolutionPreset(resolution_preset_);
 
   // Init channels
@@ -334,41 +339,21 @@ CameraDevice::CameraDevice(flutter::PluginRegistrar *registrar,
           kFlutterDesktopGpuSurfaceTypeNone,
           [this](size_t width,
                  size_t height) -> const FlutterDesktopGpuSurfaceDescriptor * {
-            std::lock_guard<std::mutex> lock(mutex_);
-            if (!current_packet_) {
-              return nullptr;
-            }
-            tbm_surface_h surface = nullptr;
-            int ret = media_packet_get_tbm_surface(current_packet_, &surface);
-            if (ret != MEDIA_PACKET_ERROR_NONE) {
-              LOG_ERROR("media_packet_get_tbm_surface failed, error: %d", ret);
-              media_packet_destroy(current_packet_);
-              current_packet_ = nullptr;
-              return nullptr;
-            }
-            gpu_surface_->handle = surface;
-            gpu_surface_->width = width;
-            gpu_surface_->height = height;
-            gpu_surface_->release_callback = [](void *release_context) {
-              CameraDevice *cd = (CameraDevice *)release_context;
-              cd->ReleaseMediaPacket();
-            };
-            gpu_surface_->release_context = this;
-            return gpu_surface_.get();
+            return preview_packet_queue_.Acquire(width, height);
           }));
   texture_id_ =
       registrar_->texture_registrar()->RegisterTexture(texture_variant_.get());
-  gpu_surface_ = std::make_unique<FlutterDesktopGpuSurfaceDescriptor>();
 
   LOG_DEBUG("texture_id_[%ld]", texture_id_);
   camera_method_channel_ =
       std::make_unique<CameraMethodChannel>(registrar_, texture_id_);
   device_method_channel_ = std::make_unique<DeviceMethodChannel>(registrar_);
+  image_stream_channel_ = std::make_unique<ImageStreamChannel>(registrar_);
+  capture_writer_ = std::make_unique<CaptureWriter>();
 
-  int angle = 0;
-  GetCameraLensOrientation(angle);
   orientation_manager_ = std::make_unique<OrientationManager>(
-      device_method_channel_.get(), (OrientationType)angle,
+      device_method_channel_.get(),
+      (OrientationType)capabilities_.lens_orientation,
       type == CameraDeviceType::kFront);
 
   orientation_manager_->Start();
@@ -378,14 +363,6 @@ CameraDevice::CameraDevice(flutter::PluginRegistrar *registrar,
 
 CameraDevice::~CameraDevice() { Dispose(); }
 
-void CameraDevice::ReleaseMediaPacket() {
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (current_packet_) {
-    media_packet_destroy(current_packet_);
-    current_packet_ = nullptr;
-  }
-}
-
 bool CameraDevice::CreateCamera() {
   int error = camera_create((camera_device_e)type_, &camera_);
   RETV_LOG_ERROR_IF(error != CAMERA_ERROR_NONE, false,
@@ -411,12 +388,76 @@ bool CameraDevice::ClearCameraAutoFocusArea() {
   return true;
 }
 
-void CameraDevice::ChangeCameraDeviceType(CameraDeviceType type) {
+bool CameraDevice::ChangeCameraDeviceType(CameraDeviceType type) {
   int error = camera_change_device(camera_, (camera_device_e)type);
-  LOG_ERROR_IF(error != CAMERA_ERROR_NONE,
-               "camera_change_device fail - error[%d]: %s", error,
-               get_error_message(error));
+  RETV_LOG_ERROR_IF(error != CAMERA_ERROR_NONE, false,
+                    "camera_change_device fail - error[%d]: %s", error,
+                    get_error_message(error));
   type_ = type;
+  if (recorder_) {
+    LoadCapabilities();
+  }
+  return true;
+}
+
+void CameraDevice::ConfigureCamera() {
+  SetCameraExifTagEnable(true);
+  SetCameraAutoFocusMode(CameraAutoFocusMode::kNormal);
+  SetCameraFlip(type_ == CameraDeviceType::kFront ? CameraFlip::kVertical
+                                                  : CameraFlip::kNone);
+}
+
+void CameraDevice::LoadCapabilities() {
+  CameraCapabilityCache &cache = CameraCapabilityCache::GetInstance();
+  camera_device_e device = (camera_device_e)type_;
+  if (const CameraCapabilities *capabilities = cache.Find(device)) {
+    capabilities_ = *capabilities;
+    return;
+  }
+
+  LOG_DEBUG("Discover capabilities of camera device[%d]", device);
+  CameraCapabilities capabilities;
+  bool complete = GetCameraLensOrientation(capabilities.lens_orientation);
+  complete &= ForeachCameraSupportedCaptureResolutions(
+      [&capabilities](int supported_width, int supported_height) -> bool {
+        LOG_DEBUG("supported camera capture resolution width[%d] height[%d]",
+                  supported_width, supported_height);
+        capabilities.capture_resolutions.emplace_back(supported_width,
+                                                      supported_height);
+        return true;
+      });
+  complete &= ForeachCameraSupportedPreviewResolutions(
+      [&capabilities](int supported_width, int supported_height) -> bool {
+        LOG_DEBUG("supported camera preview resolution width[%d] height[%d]",
+                  supported_width, supported_height);
+        capabilities.preview_resolutions.emplace_back(supported_width,
+                                                      supported_height);
+        return true;
+      });
+  complete &= ForeachRecorderSupprotedVideoResolutions(
+      [&capabilities](int supported_width, int supported_height) -> bool {
+        LOG_DEBUG("supported recorder video resolution width[%d] height[%d]",
+                  supported_width, supported_height);
+        capabilities.recorder_resolutions.emplace_back(supported_width,
+                                                       supported_height);
+        return true;
+      });
+  capabilities.zoom_supported =
+      GetCameraZoomRange(capabilities.min_zoom, capabilities.max_zoom);
+  capabilities.exposure_supported = GetCameraExposureRange(
+      capabilities.min_exposure, capabilities.max_exposure);
+  capabilities.continuous_capture_supported =
+      IsCameraSupportedContinuousCapture();
+
+  capabilities_ = capabilities;
+  // A failed discovery is retried by the next camera rather than cached.
+  if (!complete || capabilities.capture_resolutions.empty() ||
+      capabilities.preview_resolutions.empty() ||
+      capabilities.recorder_resolutions.empty()) {
+    LOG_WARN("Capabilities of camera device[%d] are incomplete", device);
+    return;
+  }
+  cache.Add(device, std::move(capabilities));
 }
 
 void CameraDevice::Dispose() {
@@ -425,6 +466,15 @@ void CameraDevice::Dispose() {
     DestroyRecorder();
   }
 
+  if (burst_) {
+    burst_->detached = true;
+    burst_->stopped = true;
+    if (burst_->continuous && !burst_->capture_done) {
+      StopCameraContinuousCapture();
+    }
+    burst_.reset();
+  }
+
   if (camera_) {
     if (camera_state_ == CameraDeviceState::kPreview) {
       StopCameraPreview();
@@ -433,6 +483,12 @@ void CameraDevice::Dispose() {
     }
     DestroyCamera();
   }
+  // No capture callback is invoked once the camera is destroyed.
+  continuous_capture_param_.reset();
+
+  if (image_stream_channel_) {
+    image_stream_channel_->Stop();
+  }
 
   if (orientation_manager_) {
     orientation_manager_->Stop();
@@ -442,10 +498,11 @@ void CameraDevice::Dispose() {
     registrar_->texture_registrar()->UnregisterTexture(texture_id_, nullptr);
   }
 
-  if (current_packet_) {
-    media_packet_destroy(current_packet_);
-    current_packet_ = nullptr;
-  }
+  preview_packet_queue_.Clear();
+  CameraStatistics::Snapshot statistics = statistics_.GetSnapshot();
+  LOG_DEBUG("Preview frames presented[%llu], dropped[%llu]",
+            static_cast<unsigned long long>(statistics.frames_presented),
+            static_cast<unsigned long long>(statistics.frames_dropped));
 }
 
 bool CameraDevice::ForeachCameraSupportedCaptureResolutions(
@@ -541,13 +598,17 @@ bool CameraDevice::GetCameraZoomRange(int &min, int &max) {
 
 bool CameraDevice::IsCameraSupportedCaptureResolution(
     std::pair<int, int> resolution) {
-  auto iter = find_if(supported_camera_resolutions_.begin(),
-                      supported_camera_resolutions_.end(),
+  auto iter = find_if(capabilities_.capture_resolutions.begin(),
+                      capabilities_.capture_resolutions.end(),
                       [resolution](std::pair<int, int> supported) -> bool {
                         return supported.first == resolution.first &&
                                supported.second == resolution.second;
                       });
-  return iter != supported_camera_resolutions_.end();
+  return iter != capabilities_.capture_resolutions.end();
+}
+
+bool CameraDevice::IsCameraSupportedContinuousCapture() {
+  return camera_is_supported_continuous_capture(camera_);
 }
 
 bool CameraDevice::SetCameraExifTagEnable(bool enable) {
@@ -692,6 +753,22 @@ bool CameraDevice::DestroyRecorder() {
   return true;
 }
 
+bool CameraDevice::ForeachCameraSupportedPreviewResolutions(
+    const ForeachResolutionCb &callback) {
+  int error = camera_foreach_supported_preview_resolution(
+      camera_,
+      [](int width, int height, void *callback) -> bool {
+        auto cb = static_cast<ForeachResolutionCb *>(callback);
+        return (*cb)(width, height);
+      },
+      (void *)&callback);
+  RETV_LOG_ERROR_IF(
+      error != CAMERA_ERROR_NONE, false,
+      "camera_foreach_supported_preview_resolution fail - error[%d]: %s", error,
+      get_error_message(error));
+  return true;
+}
+
 bool CameraDevice::ForeachRecorderSupprotedVideoResolutions(
     const ForeachResolutionCb &callback) {
   int error = recorder_foreach_supported_video_resolution(
@@ -737,13 +814,13 @@ bool CameraDevice::GetRecorderVideoResolution(int &width, int &height) {
 
 bool CameraDevice::IsRecorderSupportedVideoResolution(
     std::pair<int, int> resolution) {
-  auto iter = find_if(supported_recorder_resolutions_.begin(),
-                      supported_recorder_resolutions_.end(),
+  auto iter = find_if(capabilities_.recorder_resolutions.begin(),
+                      capabilities_.recorder_resolutions.end(),
                       [resolution](std::pair<int, int> supported) -> bool {
                         return supported.first == resolution.first &&
                                supported.second == resolution.second;
                       });
-  return iter != supported_recorder_resolutions_.end();
+  return iter != capabilities_.recorder_resolutions.end();
 }
 
 bool CameraDevice::SetRecorderAudioChannel(RecorderAudioChannel chennel) {
@@ -921,35 +998,31 @@ Size CameraDevice::GetRecommendedPreviewResolution() {
 }
 
 double CameraDevice::GetMaxExposureOffset() {
-  int min = 0, max = 0;
-  if (!GetCameraExposureRange(min, max)) {
+  if (!capabilities_.exposure_supported) {
     throw CameraDeviceError("Failed to get max exposure offset");
   }
-  return static_cast<double>(max);
+  return static_cast<double>(capabilities_.max_exposure);
 }
 
 double CameraDevice::GetMinExposureOffset() {
-  int min = 0, max = 0;
-  if (!GetCameraExposureRange(min, max)) {
+  if (!capabilities_.exposure_supported) {
     throw CameraDeviceError("Failed to get min exposure offset");
   }
-  return static_cast<double>(min);
+  return static_cast<double>(capabilities_.min_exposure);
 }
 
 double CameraDevice::GetMaxZoomLevel() {
-  int min = 0, max = 0;
-  if (!GetCameraZoomRange(min, max)) {
+  if (!capabilities_.zoom_supported) {
     throw CameraDeviceError("Failed to get max zoom level");
   }
-  return static_cast<double>(max);
+  return static_cast<double>(capabilities_.max_zoom);
 }
 
 double CameraDevice::GetMinZoomLevel() {
-  int min = 0, max = 0;
-  if (!GetCameraZoomRange(min, max)) {
+  if (!capabilities_.zoom_supported) {
     throw CameraDeviceError("Failed to get min zoom level");
   }
-  return static_cast<double>(min);
+  return static_cast<double>(capabilities_.min_zoom);
 }
 
 void CameraDevice::Open(
@@ -963,25 +1036,10 @@ void CameraDevice::Open(
     LOG_DEBUG("Try to set pixel_format[%d]", static_cast<int>(pixel_format));
     SetCameraCaptureFormat(pixel_format);
     SetCameraPreviewFormat(pixel_format);
+    pixel_format_ = pixel_format;
   }
 
-  if (!SetCameraMediaPacketPreviewCb([](media_packet_h packet, void *data) {
-        auto self = static_cast<CameraDevice *>(data);
-        std::lock_guard<std::mutex> lock(self->mutex_);
-        if (self->current_packet_) {
-          media_packet_destroy(self->current_packet_);
-          self->current_packet_ = packet;
-          return;
-        }
-        if (self->is_preview_paused_) {
-          media_packet_destroy(packet);
-          self->current_packet_ = nullptr;
-          return;
-        }
-        self->current_packet_ = packet;
-        self->registrar_->texture_registrar()->MarkTextureFrameAvailable(
-            self->texture_id_);
-      })) {
+  if (!SetCameraMediaPacketPreviewCb(OnMediaPacketPreview)) {
     result->Error(kCameraDeviceError, "Failed to set media callback");
     return;
   }
@@ -1042,6 +1100,99 @@ void CameraDevice::Open(
   result->Success();
 }
 
+void CameraDevice::OnMediaPacketPreview(media_packet_h packet, void *data) {
+  auto self = static_cast<CameraDevice *>(data);
+  self->statistics_.OnFrameReceived();
+  if (self->is_preview_paused_) {
+    media_packet_destroy(packet);
+    return;
+  }
+
+  FrameProcessorRegistry &registry = FrameProcessorRegistry::GetInstance();
+  if (registry.HasProcessors()) {
+    registry.Process(packet);
+  }
+  if (self->image_stream_channel_->IsStreaming()) {
+    self->image_stream_channel_->OnPreviewPacket(packet);
+  }
+  if (self->preview_packet_queue_.Push(packet)) {
+    self->registrar_->texture_registrar()->MarkTextureFrameAvailable(
+        self->texture_id_);
+  }
+}
+
+Size CameraDevice::SwitchCamera(CameraDeviceType type) {
+  LOG_DEBUG("type[%d]", static_cast<int>(type));
+  if (type == type_) {
+    return GetRecommendedPreviewResolution();
+  }
+  if (recorder_state_ == RecorderState::kRecording ||
+      recorder_state_ == RecorderState::kPaused) {
+    throw CameraDeviceError("Cannot switch cameras while recording");
+  }
+  if (burst_) {
+    throw CameraDeviceError("Cannot switch cameras during a burst capture");
+  }
+
+  // The preview packets are kept, so that the texture shows the last frame
+  // of the previous camera until the new camera delivers its first frame.
+  bool was_previewing = camera_state_ == CameraDeviceState::kPreview;
+  if (was_previewing) {
+    StopCameraPreview();
+  }
+  int preview_width = 0, preview_height = 0;
+  GetCameraPreviewResolution(preview_width, preview_height);
+
+  CameraDeviceType previous_type = type_;
+  bool changed = ChangeCameraDeviceType(type);
+  if (changed) {
+    ConfigureCamera();
+    if (pixel_format_ != CameraPixelFormat::kInvalid) {
+      SetCameraCaptureFormat(pixel_format_);
+      SetCameraPreviewFormat(pixel_format_);
+    }
+    // Keep the size of the texture if the new camera supports it, which the
+    // cached capabilities tell without asking the camera.
+    auto iter = std::find(capabilities_.preview_resolutions.begin(),
+                          capabilities_.preview_resolutions.end(),
+                          std::make_pair(preview_width, preview_height));
+    if (iter != capabilities_.preview_resolutions.end()) {
+      SetCameraPreviewSize(Size{static_cast<double>(preview_width),
+                                static_cast<double>(preview_height)});
+    }
+    GetCameraPreviewResolution(preview_width_, preview_height_);
+    SetResolutionPreset(resolution_preset_);
+    zoom_level_ = 0;
+
+    orientation_manager_->Stop();
+    orientation_manager_ = std::make_unique<OrientationManager>(
+        device_method_channel_.get(),
+        (OrientationType)capabilities_.lens_orientation,
+        type_ == CameraDeviceType::kFront);
+    orientation_manager_->Start();
+  }
+
+  if (was_previewing) {
+    SetCameraMediaPacketPreviewCb(OnMediaPacketPreview);
+    StartCameraPreview();
+    try {
+      SetFocusMode(focus_mode_);
+      SetExposureMode(exposure_mode_);
+    } catch (const CameraDeviceError &error) {
+      LOG_WARN("[%s] %s", error.GetErrorCode().c_str(),
+               error.GetErrorMessage().c_str());
+    }
+  }
+  UpdateStates();
+
+  if (!changed) {
+    LOG_ERROR("Failed to switch from camera[%d]",
+              static_cast<int>(previous_type));
+    throw CameraDeviceError("Failed to switch cameras");
+  }
+  return GetRecommendedPreviewResolution();
+}
+
 void CameraDevice::PauseVideoRecording(
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>
         &&result) noexcept {
@@ -1207,10 +1358,20 @@ void CameraDevice::SetResolutionPreset(ResolutionPreset resolution_preset) {
       break;
     case ResolutionPreset::kMax: {
       // The highest resolution available
-      SetCameraCaptureResolution(supported_camera_resolutions_.back().first,
-                                 supported_camera_resolutions_.back().second);
-      SetRecorderVideoResolution(supported_recorder_resolutions_.back().first,
-                                 supported_recorder_resolutions_.back().second);
+      if (!capabilities_.capture_resolutions.empty()) {
+        SetCameraCaptureResolution(
+            capabilities_.capture_resolutions.back().first,
+            capabilities_.capture_resolutions.back().second);
+      } else {
+        LOG_WARN("No supported capture resolution!");
+      }
+      if (!capabilities_.recorder_resolutions.empty()) {
+        SetRecorderVideoResolution(
+            capabilities_.recorder_resolutions.back().first,
+            capabilities_.recorder_resolutions.back().second);
+      } else {
+        LOG_WARN("No supported video resolution!");
+      }
       return;
     } break;
     default:
@@ -1289,6 +1450,7 @@ void CameraDevice::StopVideoRecording(
 }
 
 void CameraDevice::TakePicture(
+    bool in_memory, bool sync_file,
     std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>
         &&result) noexcept {
   SetCameraExifTagOrientatoin(ChooseExifTagOrientatoin(
@@ -1296,13 +1458,48 @@ void CameraDevice::TakePicture(
                              : orientation_manager_->GetDeviceOrientationType(),
       type_ == CameraDeviceType::kFront));
   auto p_result = result.release();
+  auto start_time = CameraStatistics::Clock::now();
   if (!StartCameraCapture(
-          [p_result, this](const std::string &captured_file_path) {
-            flutter::EncodableValue value(captured_file_path);
-            p_result->Success(value);
+          [p_result, in_memory, sync_file, start_time,
+           this](std::vector<uint8_t> image) {
+            statistics_.OnCaptureCompleted(CameraStatistics::Clock::now() -
+                                           start_time);
+            // The preview restarts while the image is being written.
             StartCameraPreview();
             UpdateStates();
-            delete p_result;
+            if (in_memory) {
+              p_result->Success(flutter::EncodableValue(std::move(image)));
+              statistics_.OnPictureReturned(CameraStatistics::Clock::now() -
+                                            start_time);
+              delete p_result;
+              return;
+            }
+
+            std::string captured_file_path = CreateTempFileName("CAP", "jpg");
+            if (captured_file_path.empty()) {
+              p_result->Error("Insufficient memory", "app_get_cache_path fail");
+              delete p_result;
+              return;
+            }
+            // The latency is recorded on the writer thread, since the
+            // device may be gone by the time the result is posted.
+            capture_writer_->Write(
+                std::move(captured_file_path), std::move(image), sync_file,
+                [p_result](const std::string &path,
+                           const std::string &error_message) {
+                  if (error_message.empty()) {
+                    p_result->Success(flutter::EncodableValue(path));
+                  } else {
+                    p_result->Error("Insufficient memory", error_message);
+                  }
+                  delete p_result;
+                },
+                [start_time, this](const std::string &error_message) {
+                  if (error_message.empty()) {
+                    statistics_.OnPictureReturned(
+                        CameraStatistics::Clock::now() - start_time);
+                  }
+                });
           },
           [p_result](const std::string &code, const std::string &message) {
             p_result->Error(code, message);
@@ -1314,6 +1511,242 @@ void CameraDevice::TakePicture(
   UpdateStates();
 }
 
+void CameraDevice::StartBurstCapture(int count, int interval_ms,
+                                     bool sync_file) {
+  LOG_DEBUG("count[%d] interval_ms[%d]", count, interval_ms);
+  if (burst_) {
+    throw CameraDeviceError("A burst capture is already in progress");
+  }
+  if (count < 0 || interval_ms < 0) {
+    throw CameraDeviceError("Invalid burst count or interval");
+  }
+
+  SetCameraExifTagOrientatoin(ChooseExifTagOrientatoin(
+      is_orientation_locked_ ? locked_orientation_
+                             : orientation_manager_->GetDeviceOrientationType(),
+      type_ == CameraDeviceType::kFront));
+
+  auto state = std::make_shared<BurstState>();
+  state->count = count;
+  state->interval_ms = interval_ms;
+  state->sync_file = sync_file;
+  // A single picture needs no continuous capture.
+  state->continuous =
+      count != 1 && capabilities_.continuous_capture_supported;
+  bool started = state->continuous ? StartBurstBatch(state)
+                                   : TakeBurstShot(state);
+  if (!started) {
+    throw CameraDeviceError("Failed to start burst capture");
+  }
+  burst_ = state;
+  UpdateStates();
+}
+
+void CameraDevice::StopBurstCapture() {
+  LOG_DEBUG("enter");
+  if (!burst_ || burst_->stopped) {
+    return;
+  }
+  burst_->stopped = true;
+  if (burst_->continuous) {
+    StopCameraContinuousCapture();
+    OnBurstCaptureDone(burst_);
+  }
+  // Otherwise the burst ends when the picture being taken completes.
+}
+
+bool CameraDevice::StartBurstBatch(const std::shared_ptr<BurstState> &state) {
+  int count = kMaxContinuousCaptureCount;
+  if (state->count > 0) {
+    count = std::min(count, state->count - state->captured);
+  }
+  if (count == 1) {
+    return TakeBurstShot(state);
+  }
+
+  auto param = std::make_unique<ContinuousCaptureParam>(
+      ContinuousCaptureParam{this, state});
+  if (!StartCameraContinuousCapture(
+          count, state->interval_ms,
+          [](camera_image_data_s *image, camera_image_data_s *postview,
+             camera_image_data_s *thumbnail, void *user_data) {
+            auto *p = static_cast<ContinuousCaptureParam *>(user_data);
+            if (!image || !image->data) {
+              LOG_ERROR("Continuous capture returned no image");
+              return;
+            }
+            p->self->OnBurstImage(
+                p->state, std::vector<uint8_t>(image->data,
+                                               image->data + image->size));
+          },
+          [](void *user_data) {
+            auto *p = static_cast<ContinuousCaptureParam *>(user_data);
+            // StartBurstBatch() frees |p| when it starts the next batch.
+            CameraDevice *self = p->self;
+            std::shared_ptr<BurstState> state = p->state;
+            if (!state->stopped &&
+                (state->count == 0 || state->captured < state->count)) {
+              self->StartCameraPreview();
+              if (self->StartBurstBatch(state)) {
+                return;
+              }
+            }
+            self->OnBurstCaptureDone(state);
+          },
+          param.get())) {
+    return false;
+  }
+  continuous_capture_param_ = std::move(param);
+  return true;
+}
+
+bool CameraDevice::TakeBurstShot(const std::shared_ptr<BurstState> &state) {
+  state->next_shot_time = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds(state->interval_ms);
+  return StartCameraCapture(
+      [this, state](std::vector<uint8_t> image) {
+        StartCameraPreview();
+        OnBurstImage(state, std::move(image));
+        if (state->stopped ||
+            (state->count > 0 && state->captured >= state->count)) {
+          OnBurstCaptureDone(state);
+          return;
+        }
+
+        auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(
+            state->next_shot_time - std::chrono::steady_clock::now());
+        PostTask(
+            [this, state]() {
+              if (state->detached) {
+                return;
+              }
+              if (state->stopped || !TakeBurstShot(state)) {
+                OnBurstCaptureDone(state);
+              }
+            },
+            static_cast<guint>(std::max<int64_t>(delay.count(), 0)));
+      },
+      [this, state](const std::string &code, const std::string &message) {
+        LOG_ERROR("Burst capture failed - %s: %s", code.c_str(),
+                  message.c_str());
+        OnBurstCaptureDone(state);
+      });
+}
+
+void CameraDevice::OnBurstImage(const std::shared_ptr<BurstState> &state,
+                                std::vector<uint8_t> image) {
+  int index = state->captured++;
+  // Pictures of a burst can be taken within the same millisecond.
+  std::string path =
+      CreateTempFileName("BURST" + std::to_string(index) + "_", "jpg");
+  capture_writer_->Write(
+      std::move(path), std::move(image), state->sync_file,
+      [this, state, index](const std::string &path,
+                           const std::string &error_message) {
+        if (state->detached) {
+          return;
+        }
+        state->written++;
+        if (error_message.empty()) {
+          flutter::EncodableMap map = {
+              {flutter::EncodableValue("index"),
+               flutter::EncodableValue(index)},
+              {flutter::EncodableValue("path"), flutter::EncodableValue(path)},
+          };
+          camera_method_channel_->Send(
+              CameraEventType::kBurstImage,
+              std::make_unique<flutter::EncodableValue>(map));
+        } else {
+          flutter::EncodableMap map = {
+              {flutter::EncodableValue("description"),
+               flutter::EncodableValue("Failed to write burst image: " +
+                                       error_message)},
+          };
+          camera_method_channel_->Send(
+              CameraEventType::kError,
+              std::make_unique<flutter::EncodableValue>(map));
+        }
+        MaybeFinishBurst(state);
+      });
+}
+
+void CameraDevice::OnBurstCaptureDone(
+    const std::shared_ptr<BurstState> &state) {
+  PostTask([this, state]() {
+    if (state->detached || state->capture_done) {
+      return;
+    }
+    state->capture_done = true;
+    UpdateStates();
+    if (camera_state_ == CameraDeviceState::kCaputred) {
+      StartCameraPreview();
+      UpdateStates();
+    }
+    MaybeFinishBurst(state);
+  });
+}
+
+void CameraDevice::MaybeFinishBurst(const std::shared_ptr<BurstState> &state) {
+  if (!state->capture_done || state->written < state->captured) {
+    return;
+  }
+  LOG_DEBUG("Burst capture completed, count[%d]", state->written);
+  flutter::EncodableMap map = {
+      {flutter::EncodableValue("count"),
+       flutter::EncodableValue(state->written)},
+  };
+  camera_method_channel_->Send(CameraEventType::kBurstCompleted,
+                               std::make_unique<flutter::EncodableValue>(map));
+  if (burst_ == state) {
+    burst_.reset();
+  }
+}
+
+flutter::EncodableValue CameraDevice::GetStatistics() const {
+  CameraStatistics::Snapshot statistics = statistics_.GetSnapshot();
+  flutter::EncodableMap map = {
+      {flutter::EncodableValue("framesReceived"),
+       flutter::EncodableValue(
+           static_cast<int64_t>(statistics.frames_received))},
+      {flutter::EncodableValue("framesPresented"),
+       flutter::EncodableValue(
+           static_cast<int64_t>(statistics.frames_presented))},
+      {flutter::EncodableValue("framesDropped"),
+       flutter::EncodableValue(
+           static_cast<int64_t>(statistics.frames_dropped))},
+      {flutter::EncodableValue("fps"), flutter::EncodableValue(statistics.fps)},
+      {flutter::EncodableValue("latencyP50"),
+       flutter::EncodableValue(statistics.latency_p50)},
+      {flutter::EncodableValue("latencyP90"),
+       flutter::EncodableValue(statistics.latency_p90)},
+      {flutter::EncodableValue("latencyP99"),
+       flutter::EncodableValue(statistics.latency_p99)},
+      {flutter::EncodableValue("captures"),
+       flutter::EncodableValue(static_cast<int64_t>(statistics.captures))},
+      {flutter::EncodableValue("lastCaptureTime"),
+       flutter::EncodableValue(statistics.last_capture_time)},
+      {flutter::EncodableValue("averageCaptureTime"),
+       flutter::EncodableValue(statistics.average_capture_time)},
+      {flutter::EncodableValue("lastPictureTime"),
+       flutter::EncodableValue(statistics.last_picture_time)},
+  };
+  return flutter::EncodableValue(map);
+}
+
+void CameraDevice::StartImageStream(int max_frame_rate) {
+  LOG_DEBUG("enter");
+  image_stream_channel_->Start(max_frame_rate);
+}
+
+void CameraDevice::StopImageStream() {
+  LOG_DEBUG("enter");
+  image_stream_channel_->Stop();
+}
+
+void CameraDevice::AcknowledgeImageStreamFrame() {
+  image_stream_channel_->AcknowledgeFrame();
+}
+
 void CameraDevice::LockCaptureOrientation(OrientationType orientation) {
   locked_orientation_ =
       orientation_manager_->ConvertOrientation(orientation, false);
@@ -1380,7 +1813,7 @@ bool CameraDevice::StartCameraCapture(const OnCaptureSuccessCb &on_success,
   struct Param {
     OnCaptureSuccessCb on_success;
     OnCaptureFailureCb on_failure;
-    std::string captured_file_path;
+    std::vector<uint8_t> image;
     std::string error;
     std::string error_message;
   };
@@ -1399,33 +1832,16 @@ bool CameraDevice::StartCameraCapture(const OnCaptureSuccessCb &on_success,
           p->error_message = "camera_start_capture fail";
           return;
         }
-
-        p->captured_file_path = CreateTempFileName("CAP", "jpg");
-        if (!p->captured_file_path.size()) {
-          p->error = "Insufficient memory";
-          p->error_message = "app_get_cache_path fail";
-          return;
-        }
-
-        FILE *file = fopen(p->captured_file_path.c_str(), "w+");
-        if (!file) {
-          p->error = "Insufficient memory";
-          p->error_message = "fopen fail";
-          return;
-        }
-
-        if (fwrite(image->data, 1, image->size, file) != image->size) {
-          p->error = "Insufficient memory";
-          p->error_message = "fwrite fail";
-        }
-        fclose(file);
+        // Only copy the image here. Writing it to storage is left to the
+        // caller, so that it does not delay the completion of the capture.
+        p->image.assign(image->data, image->data + image->size);
       },
       [](void *user_data) {
         Param *p = (Param *)user_data;
         if (p->error.size()) {
           p->on_failure(p->error, p->error_message);
         } else {
-          p->on_success(p->captured_file_path);
+          p->on_success(std::move(p->image));
         }
         delete p;
       },
@@ -1441,6 +1857,25 @@ bool CameraDevice::StartCameraCapture(const OnCaptureSuccessCb &on_success,
   return true;
 }
 
+bool CameraDevice::StartCameraContinuousCapture(
+    int count, int interval_ms, CameraCapturingCb capturing_cb,
+    CameraCaptureCompletedCb completed_cb, void *user_data) {
+  int error = camera_start_continuous_capture(
+      camera_, count, interval_ms, capturing_cb, completed_cb, user_data);
+  RETV_LOG_ERROR_IF(error != CAMERA_ERROR_NONE, false,
+                    "camera_start_continuous_capture fail - error[%d]: %s",
+                    error, get_error_message(error));
+  return true;
+}
+
+bool CameraDevice::StopCameraContinuousCapture() {
+  int error = camera_stop_continuous_capture(camera_);
+  RETV_LOG_ERROR_IF(error != CAMERA_ERROR_NONE, false,
+                    "camera_stop_continuous_capture fail - error[%d]: %s",
+                    error, get_error_message(error));
+  return true;
+}
+
 bool CameraDevice::StartCameraAutoFocusing(bool continuous) {
   int error = camera_start_focusing(camera_, continuous);
   RETV_LOG_ERROR_IF(error != CAMERA_ERROR_NONE, false,
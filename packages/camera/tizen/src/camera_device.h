@@ -11,11 +11,19 @@
 #include <flutter/plugin_registrar.h>
 #include <recorder.h>
 
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <mutex>
 
+#include "camera_capabilities.h"
 #include "camera_method_channel.h"
+#include "camera_statistics.h"
+#include "capture_writer.h"
 #include "device_method_channel.h"
+#include "image_stream_channel.h"
 #include "orientation_manager.h"
+#include "preview_packet_queue.h"
 
 #define kCameraDeviceError "CameraDeviceError"
 
@@ -30,8 +38,7 @@ using RecorderStateChangedCb = recorder_state_changed_cb;
 using RecorderStateChangedCb = recorder_state_changed_cb;
 
 using ForeachResolutionCb = std::function<bool(int width, int height)>;
-using OnCaptureSuccessCb =
-    std::function<void(const std::string &captured_file_path)>;
+using OnCaptureSuccessCb = std::function<void(std::vector<uint8_t> image)>;
 using OnCaptureFailureCb =
     std::function<void(const std::string &code, const std::string &message)>;
 
@@ -212,7 +219,7 @@ class CameraDevice {
                ResolutionPreset resolution_preset, bool enable_audio);
   ~CameraDevice();
 
-  void ChangeCameraDeviceType(CameraDeviceType type);
+  bool ChangeCameraDeviceType(CameraDeviceType type);
   void Dispose();
   Size GetRecommendedPreviewResolution();
   long GetTextureId() { return texture_id_; }
@@ -223,6 +230,10 @@ class CameraDevice {
   void Open(std::string image_format_group,
             std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>
                 &&result) noexcept;
+  // Switches to the camera of |type| in place. The texture stays registered
+  // and the preview restarts with the same settings. Returns the new
+  // preview size.
+  Size SwitchCamera(CameraDeviceType type);
   void PauseVideoRecording(
       std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>
           &&result) noexcept;
@@ -243,24 +254,76 @@ class CameraDevice {
   void StopVideoRecording(
       std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>
           &&result) noexcept;
+  // Returns the JPEG bytes if |in_memory| is true, or the path of a file
+  // otherwise. If |sync_file| is true, the file is flushed to storage before
+  // the result is returned.
   void TakePicture(
+      bool in_memory, bool sync_file,
       std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>
           &&result) noexcept;
 
   void LockCaptureOrientation(OrientationType orientation);
   void UnlockCaptureOrientation();
 
+  // Takes |count| pictures, or pictures until StopBurstCapture() is called
+  // if |count| is 0, no more often than once per |interval_ms|. Each file is
+  // reported with a burst_image event as soon as it has been written.
+  void StartBurstCapture(int count, int interval_ms, bool sync_file);
+  void StopBurstCapture();
+
+  void StartImageStream(int max_frame_rate);
+  void StopImageStream();
+  void AcknowledgeImageStreamFrame();
+
+  flutter::EncodableValue GetStatistics() const;
+
   void PausePreview() { is_preview_paused_ = true; }
   void ResumePreview() { is_preview_paused_ = false; }
 
-  void ReleaseMediaPacket();
-
  private:
+  // Shared with the capture callbacks and the pending main loop callbacks,
+  // which may outlive the burst.
+  struct BurstState {
+    int count = 0;
+    int interval_ms = 0;
+    bool sync_file = false;
+    bool continuous = false;
+    std::atomic<bool> stopped{false};
+    std::atomic<int> captured{0};
+    // Only accessed on the thread of the capture callbacks.
+    std::chrono::steady_clock::time_point next_shot_time;
+    // Only accessed on the platform thread.
+    int written = 0;
+    bool capture_done = false;
+    bool detached = false;
+  };
+
+  // The user data of a continuous capture batch.
+  struct ContinuousCaptureParam {
+    CameraDevice *self;
+    std::shared_ptr<BurstState> state;
+  };
+
+  bool StartBurstBatch(const std::shared_ptr<BurstState> &state);
+  bool TakeBurstShot(const std::shared_ptr<BurstState> &state);
+  void OnBurstImage(const std::shared_ptr<BurstState> &state,
+                    std::vector<uint8_t> image);
+  void OnBurstCaptureDone(const std::shared_ptr<BurstState> &state);
+  void MaybeFinishBurst(const std::shared_ptr<BurstState> &state);
+
+  static void OnMediaPacketPreview(media_packet_h packet, void *data);
+
+  // Applies the settings that do not depend on the preview to the current
+  // camera device.
+  void ConfigureCamera();
+
   bool CreateCamera();
   bool ClearCameraAutoFocusArea();
   bool DestroyCamera();
   bool ForeachCameraSupportedCaptureResolutions(
       const ForeachResolutionCb &callback);
+  bool ForeachCameraSupportedPreviewResolutions(
+      const ForeachResolutionCb &callback);
   bool GetCameraCaptureResolution(int &width, int &height);
   bool GetCameraDeviceCount(int &count);
   bool GetCameraFocusMode(CameraAutoFocusMode &mode);
@@ -269,6 +332,7 @@ class CameraDevice {
   bool GetCameraState(CameraDeviceState &state);
   bool GetCameraZoomRange(int &min, int &max);
   bool IsCameraSupportedCaptureResolution(std::pair<int, int> resolution);
+  bool IsCameraSupportedContinuousCapture();
   bool SetCameraFlashMode(CameraFlashMode mode);
   bool SetCameraFlip(CameraFlip flip);
   bool SetCameraExposure(int offset);
@@ -288,9 +352,14 @@ class CameraDevice {
   bool SetCameraZoom(int zoom);
   bool StartCameraCapture(const OnCaptureSuccessCb &on_success,
                           const OnCaptureFailureCb &on_failure);
+  bool StartCameraContinuousCapture(int count, int interval_ms,
+                                    CameraCapturingCb capturing_cb,
+                                    CameraCaptureCompletedCb completed_cb,
+                                    void *user_data);
   bool StartCameraAutoFocusing(bool continuous);
   bool StartCameraPreview();
   bool StopCameraAutoFocusing();
+  bool StopCameraContinuousCapture();
   bool StopCameraPreview();
   bool UnsetCameraMediaPacketPreviewCb();
   bool UnsetCameraAutoFocusChangedCb();
@@ -325,17 +394,25 @@ class CameraDevice {
   bool UnprepareRecorder();
   bool UnsetRecorderRecordingLimitReachedCb();
   void UpdateStates();
+  // Uses the cached capabilities of the current device, discovering them if
+  // this is the first camera of the device in the process.
+  void LoadCapabilities();
 
   long texture_id_{0};
   flutter::PluginRegistrar *registrar_{nullptr};
   std::unique_ptr<flutter::TextureVariant> texture_variant_;
-  std::unique_ptr<FlutterDesktopGpuSurfaceDescriptor> gpu_surface_;
-  media_packet_h current_packet_{nullptr};
-
-  std::mutex mutex_;
+  CameraStatistics statistics_;
+  PreviewPacketQueue preview_packet_queue_{statistics_};
 
   std::unique_ptr<CameraMethodChannel> camera_method_channel_;
   std::unique_ptr<DeviceMethodChannel> device_method_channel_;
+  std::unique_ptr<ImageStreamChannel> image_stream_channel_;
+  std::unique_ptr<CaptureWriter> capture_writer_;
+  std::shared_ptr<BurstState> burst_;
+  // Owned here rather than by the completed callback, which may not be
+  // invoked when the capture is stopped. Replaced by the next batch and freed
+  // once the camera is destroyed.
+  std::unique_ptr<ContinuousCaptureParam> continuous_capture_param_;
   std::unique_ptr<OrientationManager> orientation_manager_;
 
   camera_h camera_{nullptr};
@@ -357,8 +434,9 @@ class CameraDevice {
   int zoom_level_{0};
 
   ResolutionPreset resolution_preset_{ResolutionPreset::kLow};
-  std::vector<std::pair<int, int>> supported_camera_resolutions_;
-  std::vector<std::pair<int, int>> supported_recorder_resolutions_;
+  CameraCapabilities capabilities_;
+
+  CameraPixelFormat pixel_format_{CameraPixelFormat::kInvalid};
 
   bool enable_audio_{true};
   bool is_preview_paused_{false};
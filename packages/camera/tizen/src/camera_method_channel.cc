@@ -18,6 +18,10 @@ std::string EventTypeToString(CameraEventType type) {
     return "cameraClosing";
   } else if (type == CameraEventType::kInitialized) {
     return "initialized";
+  } else if (type == CameraEventType::kBurstImage) {
+    return "burst_image";
+  } else if (type == CameraEventType::kBurstCompleted) {
+    return "burst_completed";
   }
   LOG_WARN("Unknown event type!");
   return "unknown";
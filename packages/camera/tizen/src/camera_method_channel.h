@@ -15,6 +15,8 @@ enum class CameraEventType {
   kError,
   kCameraClosing,
   kInitialized,
+  kBurstImage,
+  kBurstCompleted,
 };
 
 class CameraMethodChannel {
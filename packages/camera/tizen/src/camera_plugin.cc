@@ -12,6 +12,7 @@
 #include <string>
 
 #include "camera_device.h"
+#include "frame_processor_registry.h"
 #include "log.h"
 #include "permission_manager.h"
 
@@ -43,6 +44,9 @@ class CameraPlugin : public flutter::Plugin {
           plugin_pointer->HandleMethodCall(call, std::move(result));
         });
 
+    FrameProcessorRegistry::GetInstance().SetUpEventChannel(
+        registrar->messenger());
+
     registrar->AddPlugin(std::move(camera_plugin));
   }
 
@@ -121,7 +125,15 @@ class CameraPlugin : public flutter::Plugin {
       }
       result->Error("InvalidArguments", "Please check 'imageFormatGroup'");
     } else if (method_name == "takePicture") {
-      camera_->TakePicture(std::move(result));
+      bool in_memory = false;
+      bool sync_file = false;
+      if (method_call.arguments()) {
+        flutter::EncodableMap arguments =
+            std::get<flutter::EncodableMap>(*method_call.arguments());
+        GetValueFromEncodableMap(arguments, "inMemory", in_memory);
+        GetValueFromEncodableMap(arguments, "syncFile", sync_file);
+      }
+      camera_->TakePicture(in_memory, sync_file, std::move(result));
     } else if (method_name == "prepareForVideoRecording") {
       result->NotImplemented();
     } else if (method_name == "startVideoRecording") {
@@ -245,10 +257,67 @@ class CameraPlugin : public flutter::Plugin {
         }
       }
       result->Error("InvalidArguments", "Please check arguments(reset or x,y");
+    } else if (method_name == "switchCamera") {
+      if (method_call.arguments()) {
+        flutter::EncodableMap arguments =
+            std::get<flutter::EncodableMap>(*method_call.arguments());
+        std::string camera_name;
+        if (GetValueFromEncodableMap(arguments, "cameraName", camera_name)) {
+          CameraDeviceType type = camera_name == "camera1"
+                                      ? CameraDeviceType::kRear
+                                      : CameraDeviceType::kFront;
+          try {
+            Size size = camera_->SwitchCamera(type);
+            flutter::EncodableMap map;
+            map[flutter::EncodableValue("previewWidth")] =
+                flutter::EncodableValue(size.width);
+            map[flutter::EncodableValue("previewHeight")] =
+                flutter::EncodableValue(size.height);
+            result->Success(flutter::EncodableValue(map));
+          } catch (const CameraDeviceError &error) {
+            result->Error(error.GetErrorCode(), error.GetErrorMessage());
+          }
+          return;
+        }
+      }
+      result->Error("InvalidArguments", "Please check 'cameraName'");
+    } else if (method_name == "getStatistics") {
+      result->Success(camera_->GetStatistics());
+    } else if (method_name == "startBurstCapture") {
+      int32_t count = 0;
+      int32_t interval = 0;
+      bool sync_file = false;
+      if (method_call.arguments()) {
+        flutter::EncodableMap arguments =
+            std::get<flutter::EncodableMap>(*method_call.arguments());
+        GetValueFromEncodableMap(arguments, "count", count);
+        GetValueFromEncodableMap(arguments, "interval", interval);
+        GetValueFromEncodableMap(arguments, "syncFile", sync_file);
+      }
+      try {
+        camera_->StartBurstCapture(count, interval, sync_file);
+        result->Success();
+      } catch (const CameraDeviceError &error) {
+        result->Error(error.GetErrorCode(), error.GetErrorMessage());
+      }
+    } else if (method_name == "stopBurstCapture") {
+      camera_->StopBurstCapture();
+      result->Success();
     } else if (method_name == "startImageStream") {
-      result->NotImplemented();
+      int32_t max_frame_rate = 0;
+      if (method_call.arguments()) {
+        flutter::EncodableMap arguments =
+            std::get<flutter::EncodableMap>(*method_call.arguments());
+        GetValueFromEncodableMap(arguments, "maxFrameRate", max_frame_rate);
+      }
+      camera_->StartImageStream(max_frame_rate);
+      result->Success();
     } else if (method_name == "stopImageStream") {
-      result->NotImplemented();
+      camera_->StopImageStream();
+      result->Success();
+    } else if (method_name == "receivedImageStreamData") {
+      camera_->AcknowledgeImageStreamFrame();
+      result->Success();
     } else if (method_name == "getMaxZoomLevel") {
       try {
         float max = camera_->GetMaxZoomLevel();
@@ -0,0 +1,111 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "camera_statistics.h"
+
+#include <algorithm>
+
+namespace {
+
+int64_t ToNanoseconds(CameraStatistics::Clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             time.time_since_epoch())
+      .count();
+}
+
+int64_t ToMicroseconds(CameraStatistics::Clock::duration duration) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration)
+      .count();
+}
+
+}  // namespace
+
+void CameraStatistics::OnFrameReceived() {
+  // Only the camera thread writes the frame times, so the slot of the next
+  // frame is written before the frame is published.
+  uint64_t frame = frames_received_.load(std::memory_order_relaxed);
+  frame_times_[frame % kFrameTimeCount].store(ToNanoseconds(Clock::now()),
+                                              std::memory_order_relaxed);
+  frames_received_.store(frame + 1, std::memory_order_release);
+}
+
+void CameraStatistics::OnFrameDropped() {
+  frames_dropped_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CameraStatistics::OnFramePresented(Clock::duration latency) {
+  // Only the raster thread writes the latencies, like the frame times above.
+  uint64_t frame = frames_presented_.load(std::memory_order_relaxed);
+  latency_samples_[frame % kLatencySampleCount].store(
+      std::max<int64_t>(ToMicroseconds(latency), 0),
+      std::memory_order_relaxed);
+  frames_presented_.store(frame + 1, std::memory_order_release);
+}
+
+void CameraStatistics::OnCaptureCompleted(Clock::duration capture_time) {
+  int64_t us = ToMicroseconds(capture_time);
+  last_capture_time_us_.store(us, std::memory_order_relaxed);
+  total_capture_time_us_.fetch_add(us, std::memory_order_relaxed);
+  captures_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CameraStatistics::OnPictureReturned(Clock::duration picture_time) {
+  last_picture_time_us_.store(ToMicroseconds(picture_time),
+                              std::memory_order_relaxed);
+}
+
+CameraStatistics::Snapshot CameraStatistics::GetSnapshot() const {
+  Snapshot snapshot;
+  snapshot.frames_received = frames_received_.load(std::memory_order_acquire);
+  snapshot.frames_presented =
+      frames_presented_.load(std::memory_order_acquire);
+  snapshot.frames_dropped = frames_dropped_.load(std::memory_order_relaxed);
+
+  uint64_t count =
+      std::min<uint64_t>(snapshot.frames_received, kFrameTimeCount);
+  if (count >= 2) {
+    uint64_t newest_frame = snapshot.frames_received - 1;
+    int64_t newest = frame_times_[newest_frame % kFrameTimeCount].load(
+        std::memory_order_relaxed);
+    int64_t oldest =
+        frame_times_[(newest_frame - count + 1) % kFrameTimeCount].load(
+            std::memory_order_relaxed);
+    bool stalled = ToNanoseconds(Clock::now()) - newest > 1000000000;
+    if (newest > oldest && !stalled) {
+      snapshot.fps = (count - 1) * 1e9 / (newest - oldest);
+    }
+  }
+
+  size_t sample_count = static_cast<size_t>(
+      std::min<uint64_t>(snapshot.frames_presented, kLatencySampleCount));
+  std::vector<int64_t> samples(sample_count);
+  for (size_t i = 0; i < sample_count; i++) {
+    samples[i] = latency_samples_[i].load(std::memory_order_relaxed);
+  }
+  std::sort(samples.begin(), samples.end());
+  snapshot.latency_p50 = GetPercentile(samples, 0.5);
+  snapshot.latency_p90 = GetPercentile(samples, 0.9);
+  snapshot.latency_p99 = GetPercentile(samples, 0.99);
+
+  snapshot.captures = captures_.load(std::memory_order_relaxed);
+  snapshot.last_capture_time =
+      last_capture_time_us_.load(std::memory_order_relaxed) / 1000.0;
+  if (snapshot.captures > 0) {
+    snapshot.average_capture_time =
+        total_capture_time_us_.load(std::memory_order_relaxed) / 1000.0 /
+        snapshot.captures;
+  }
+  snapshot.last_picture_time =
+      last_picture_time_us_.load(std::memory_order_relaxed) / 1000.0;
+  return snapshot;
+}
+
+double CameraStatistics::GetPercentile(
+    const std::vector<int64_t> &sorted_samples, double percentile) {
+  if (sorted_samples.empty()) {
+    return 0;
+  }
+  size_t rank = static_cast<size_t>(percentile * (sorted_samples.size() - 1));
+  return sorted_samples[rank] / 1000.0;
+}
@@ -0,0 +1,81 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_CAMERA_STATISTICS_H_
+#define FLUTTER_PLUGIN_CAMERA_STATISTICS_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// Preview and capture performance counters of a camera device.
+//
+// The counters are updated without locks, so that they can be maintained on
+// the camera and raster threads for every frame. A snapshot may mix values
+// of consecutive frames.
+class CameraStatistics {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Snapshot {
+    uint64_t frames_received = 0;
+    uint64_t frames_presented = 0;
+    uint64_t frames_dropped = 0;
+    // Over the latest frames, or 0 if no frame has arrived for a second.
+    double fps = 0;
+    // From the preview callback to the texture being drawn over the latest
+    // kLatencySampleCount frames, in milliseconds.
+    double latency_p50 = 0;
+    double latency_p90 = 0;
+    double latency_p99 = 0;
+    uint64_t captures = 0;
+    // From the capture request to the capture completion, in milliseconds.
+    double last_capture_time = 0;
+    double average_capture_time = 0;
+    // From the capture request to the result being ready (the file being
+    // written unless the picture is returned in memory), in milliseconds.
+    double last_picture_time = 0;
+  };
+
+  // Called on the camera thread only.
+  void OnFrameReceived();
+  void OnFrameDropped();
+
+  // Called on the raster thread.
+  void OnFramePresented(Clock::duration latency);
+
+  void OnCaptureCompleted(Clock::duration capture_time);
+  void OnPictureReturned(Clock::duration picture_time);
+
+  Snapshot GetSnapshot() const;
+
+  // The number of latest frames the latency percentiles are computed over,
+  // about 8 seconds at 30 fps, so that they follow changes in load.
+  static constexpr size_t kLatencySampleCount = 256;
+
+ private:
+  // The number of frames the frame rate is measured over.
+  static constexpr size_t kFrameTimeCount = 32;
+  static double GetPercentile(const std::vector<int64_t> &sorted_samples,
+                              double percentile);
+
+  std::atomic<uint64_t> frames_received_{0};
+  std::atomic<uint64_t> frames_presented_{0};
+  std::atomic<uint64_t> frames_dropped_{0};
+  // The arrival times of the latest frames in nanoseconds, indexed by the
+  // frame number.
+  std::array<std::atomic<int64_t>, kFrameTimeCount> frame_times_{};
+  // The latencies of the latest frames in microseconds, indexed by the
+  // number of presented frames.
+  std::array<std::atomic<int64_t>, kLatencySampleCount> latency_samples_{};
+
+  std::atomic<uint64_t> captures_{0};
+  std::atomic<int64_t> total_capture_time_us_{0};
+  std::atomic<int64_t> last_capture_time_us_{0};
+  std::atomic<int64_t> last_picture_time_us_{0};
+};
+
+#endif  // FLUTTER_PLUGIN_CAMERA_STATISTICS_H_
@@ -0,0 +1,100 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "capture_writer.h"
+
+#include <glib.h>
+#include <unistd.h>
+
+#include <cstdio>
+
+#include "log.h"
+
+CaptureWriter::CaptureWriter() {
+  worker_ = std::thread(&CaptureWriter::Run, this);
+}
+
+CaptureWriter::~CaptureWriter() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  cv_.notify_one();
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+}
+
+void CaptureWriter::Write(std::string path, std::vector<uint8_t> data,
+                          bool sync, WrittenCallback callback,
+                          WorkerCallback on_written) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push_back(Job{std::move(path), std::move(data), sync,
+                        std::move(callback), std::move(on_written)});
+  }
+  cv_.notify_one();
+}
+
+void CaptureWriter::Run() {
+  while (true) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this] { return stopped_ || !jobs_.empty(); });
+      if (jobs_.empty()) {
+        return;
+      }
+      job = std::move(jobs_.front());
+      jobs_.pop_front();
+    }
+
+    std::string error_message = WriteFile(job);
+    if (job.on_written) {
+      job.on_written(error_message);
+    }
+    // Release the image before the result waits in the main loop.
+    job.data = std::vector<uint8_t>();
+    PostResult(std::move(job), std::move(error_message));
+  }
+}
+
+std::string CaptureWriter::WriteFile(const Job &job) {
+  FILE *file = fopen(job.path.c_str(), "w+");
+  if (!file) {
+    LOG_ERROR("fopen fail - path[%s]", job.path.c_str());
+    return "fopen fail";
+  }
+
+  std::string error_message;
+  if (fwrite(job.data.data(), 1, job.data.size(), file) != job.data.size()) {
+    error_message = "fwrite fail";
+  } else if (job.sync && (fflush(file) != 0 || fsync(fileno(file)) != 0)) {
+    error_message = "fsync fail";
+  }
+  if (fclose(file) != 0 && error_message.empty()) {
+    error_message = "fclose fail";
+  }
+  LOG_ERROR_IF(!error_message.empty(), "%s - path[%s]", error_message.c_str(),
+               job.path.c_str());
+  return error_message;
+}
+
+void CaptureWriter::PostResult(Job job, std::string error_message) {
+  struct Param {
+    Job job;
+    std::string error_message;
+  };
+  Param *param = new Param{std::move(job), std::move(error_message)};
+
+  // Method results and events must be sent on the platform thread.
+  g_idle_add_full(
+      G_PRIORITY_DEFAULT,
+      [](gpointer data) -> gboolean {
+        auto *param = static_cast<Param *>(data);
+        param->job.callback(param->job.path, param->error_message);
+        return G_SOURCE_REMOVE;
+      },
+      param, [](gpointer data) { delete static_cast<Param *>(data); });
+}
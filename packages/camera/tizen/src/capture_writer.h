@@ -0,0 +1,66 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_CAPTURE_WRITER_H_
+#define FLUTTER_PLUGIN_CAPTURE_WRITER_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Writes captured images to files on a worker thread, so that the camera
+// callback thread is not blocked by storage and the preview can restart
+// while a file is being written.
+//
+// Files are written in the order they are queued. Files still queued when
+// the writer is destroyed are written before the destructor returns.
+class CaptureWriter {
+ public:
+  // |error_message| is empty if the file has been written.
+  using WrittenCallback = std::function<void(const std::string &path,
+                                             const std::string &error_message)>;
+  // Called on the worker thread right after the file has been written. The
+  // worker is joined on destruction, so unlike WrittenCallback it may refer
+  // to objects that outlive the writer without further checks.
+  using WorkerCallback = std::function<void(const std::string &error_message)>;
+
+  CaptureWriter();
+  ~CaptureWriter();
+
+  CaptureWriter(const CaptureWriter &) = delete;
+  CaptureWriter &operator=(const CaptureWriter &) = delete;
+
+  // Queues |data| to be written to |path|. If |sync| is true, the file is
+  // flushed to storage before |callback| is called. |callback| is called on
+  // the platform thread, after |on_written| (if any) has been called on the
+  // worker thread.
+  void Write(std::string path, std::vector<uint8_t> data, bool sync,
+             WrittenCallback callback, WorkerCallback on_written = nullptr);
+
+ private:
+  struct Job {
+    std::string path;
+    std::vector<uint8_t> data;
+    bool sync = false;
+    WrittenCallback callback;
+    WorkerCallback on_written;
+  };
+
+  void Run();
+  static std::string WriteFile(const Job &job);
+  static void PostResult(Job job, std::string error_message);
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Job> jobs_;
+  bool stopped_ = false;
+  std::thread worker_;
+};
+
+#endif  // FLUTTER_PLUGIN_CAPTURE_WRITER_H_
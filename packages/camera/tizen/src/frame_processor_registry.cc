@@ -0,0 +1,197 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "frame_processor_registry.h"
+
+#include <camera.h>
+#include <flutter/event_stream_handler_functions.h>
+#include <flutter/standard_method_codec.h>
+#include <glib.h>
+
+#include <algorithm>
+
+#include "log.h"
+
+bool ReadCameraFrame(media_packet_h packet, CameraFrame &frame) {
+  media_format_h format = nullptr;
+  int ret = media_packet_get_format(packet, &format);
+  RETV_LOG_ERROR_IF(ret != MEDIA_PACKET_ERROR_NONE, false,
+                    "media_packet_get_format fail - error[%d]", ret);
+  media_format_mimetype_e mimetype;
+  int width = 0, height = 0;
+  ret = media_format_get_video_info(format, &mimetype, &width, &height,
+                                    nullptr, nullptr);
+  media_format_unref(format);
+  RETV_LOG_ERROR_IF(ret != MEDIA_FORMAT_ERROR_NONE, false,
+                    "media_format_get_video_info fail - error[%d]", ret);
+
+  // Chroma planes are subsampled by 2 in both directions. NV12 interleaves U
+  // and V in a single plane.
+  int chroma_bytes_per_pixel = 1;
+  if (mimetype == MEDIA_FORMAT_I420) {
+    frame.format = CAMERA_PIXEL_FORMAT_I420;
+  } else if (mimetype == MEDIA_FORMAT_NV12) {
+    frame.format = CAMERA_PIXEL_FORMAT_NV12;
+    chroma_bytes_per_pixel = 2;
+  } else {
+    LOG_WARN("Unsupported preview format[0x%x]", mimetype);
+    return false;
+  }
+
+  uint32_t plane_count = 0;
+  ret = media_packet_get_number_of_video_planes(packet, &plane_count);
+  RETV_LOG_ERROR_IF(ret != MEDIA_PACKET_ERROR_NONE, false,
+                    "media_packet_get_number_of_video_planes fail - error[%d]",
+                    ret);
+  RETV_LOG_ERROR_IF(plane_count > CAMERA_FRAME_MAX_PLANES, false,
+                    "Too many planes[%u]", plane_count);
+  for (uint32_t i = 0; i < plane_count; i++) {
+    void *data = nullptr;
+    int stride_width = 0, stride_height = 0;
+    if (media_packet_get_video_plane_data_ptr(packet, i, &data) !=
+            MEDIA_PACKET_ERROR_NONE ||
+        media_packet_get_video_stride_width(packet, i, &stride_width) !=
+            MEDIA_PACKET_ERROR_NONE ||
+        media_packet_get_video_stride_height(packet, i, &stride_height) !=
+            MEDIA_PACKET_ERROR_NONE ||
+        !data) {
+      LOG_ERROR("Failed to get plane[%u] of the preview packet", i);
+      return false;
+    }
+
+    CameraFramePlane &plane = frame.planes[i];
+    plane.data = static_cast<const uint8_t *>(data);
+    plane.width = i == 0 ? width : (width + 1) / 2;
+    plane.height = i == 0 ? height : (height + 1) / 2;
+    plane.bytes_per_pixel = i == 0 ? 1 : chroma_bytes_per_pixel;
+    plane.bytes_per_row = stride_width;
+    plane.size = static_cast<size_t>(stride_width) *
+                 std::min(plane.height, stride_height);
+  }
+
+  uint64_t pts = 0;
+  media_packet_get_pts(packet, &pts);
+  frame.packet = packet;
+  frame.width = width;
+  frame.height = height;
+  frame.timestamp = static_cast<int64_t>(pts);
+  frame.plane_count = plane_count;
+  return true;
+}
+
+FrameProcessorRegistry &FrameProcessorRegistry::GetInstance() {
+  static FrameProcessorRegistry instance;
+  return instance;
+}
+
+void FrameProcessorRegistry::SetUpEventChannel(
+    flutter::BinaryMessenger *messenger) {
+  channel_ = std::make_unique<flutter::EventChannel<flutter::EncodableValue>>(
+      messenger, "plugins.flutter.io/camera_tizen/frameProcessorResults",
+      &flutter::StandardMethodCodec::GetInstance());
+
+  auto handler = std::make_unique<
+      flutter::StreamHandlerFunctions<flutter::EncodableValue>>(
+      [this](
+          const flutter::EncodableValue *arguments,
+          std::unique_ptr<flutter::EventSink<flutter::EncodableValue>> &&events)
+          -> std::unique_ptr<
+              flutter::StreamHandlerError<flutter::EncodableValue>> {
+        event_sink_ = std::move(events);
+        return nullptr;
+      },
+      [this](const flutter::EncodableValue *arguments)
+          -> std::unique_ptr<
+              flutter::StreamHandlerError<flutter::EncodableValue>> {
+        event_sink_.reset();
+        return nullptr;
+      });
+  channel_->SetStreamHandler(std::move(handler));
+}
+
+bool FrameProcessorRegistry::AddProcessor(
+    const std::string &name, CameraFrameProcessorCallback callback,
+    void *user_data) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!callback || !processors_.emplace(name, Processor{callback, user_data})
+                        .second) {
+    LOG_ERROR("Failed to add frame processor[%s]", name.c_str());
+    return false;
+  }
+  processor_count_ = processors_.size();
+  LOG_INFO("Added frame processor[%s]", name.c_str());
+  return true;
+}
+
+void FrameProcessorRegistry::RemoveProcessor(const std::string &name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (processors_.erase(name) > 0) {
+    LOG_INFO("Removed frame processor[%s]", name.c_str());
+  }
+  processor_count_ = processors_.size();
+}
+
+void FrameProcessorRegistry::Process(media_packet_h packet) {
+  CameraFrame frame = {};
+  if (!ReadCameraFrame(packet, frame)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto &[name, processor] : processors_) {
+    processor.callback(&frame, processor.user_data);
+  }
+}
+
+void FrameProcessorRegistry::SendResult(const std::string &name,
+                                        std::vector<uint8_t> data) {
+  struct Param {
+    std::string name;
+    std::vector<uint8_t> data;
+  };
+  Param *param = new Param{name, std::move(data)};
+
+  // Event sinks must be used on the platform thread.
+  g_idle_add_full(
+      G_PRIORITY_DEFAULT,
+      [](gpointer data) -> gboolean {
+        auto *param = static_cast<Param *>(data);
+        FrameProcessorRegistry &registry = GetInstance();
+        if (registry.event_sink_) {
+          flutter::EncodableMap map;
+          map[flutter::EncodableValue("name")] =
+              flutter::EncodableValue(std::move(param->name));
+          map[flutter::EncodableValue("data")] =
+              flutter::EncodableValue(std::move(param->data));
+          registry.event_sink_->Success(
+              flutter::EncodableValue(std::move(map)));
+        }
+        return G_SOURCE_REMOVE;
+      },
+      param, [](gpointer data) { delete static_cast<Param *>(data); });
+}
+
+bool CameraPluginAddFrameProcessor(const char *name,
+                                   CameraFrameProcessorCallback callback,
+                                   void *user_data) {
+  if (!name) {
+    return false;
+  }
+  return FrameProcessorRegistry::GetInstance().AddProcessor(name, callback,
+                                                            user_data);
+}
+
+void CameraPluginRemoveFrameProcessor(const char *name) {
+  if (name) {
+    FrameProcessorRegistry::GetInstance().RemoveProcessor(name);
+  }
+}
+
+void CameraPluginSendFrameProcessorResult(const char *name,
+                                          const uint8_t *data, size_t size) {
+  if (!name || (!data && size > 0)) {
+    return;
+  }
+  FrameProcessorRegistry::GetInstance().SendResult(
+      name, std::vector<uint8_t>(data, data + size));
+}
@@ -0,0 +1,61 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_FRAME_PROCESSOR_REGISTRY_H_
+#define FLUTTER_PLUGIN_FRAME_PROCESSOR_REGISTRY_H_
+
+#include <flutter/binary_messenger.h>
+#include <flutter/encodable_value.h>
+#include <flutter/event_channel.h>
+#include <media_packet.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "camera_frame_processor.h"
+
+// Fills |frame| with the planes of |packet| without copying them.
+bool ReadCameraFrame(media_packet_h packet, CameraFrame &frame);
+
+// The frame processors added by other plugins, and the channel that sends
+// their results to Dart.
+class FrameProcessorRegistry {
+ public:
+  static FrameProcessorRegistry &GetInstance();
+
+  void SetUpEventChannel(flutter::BinaryMessenger *messenger);
+
+  bool AddProcessor(const std::string &name,
+                    CameraFrameProcessorCallback callback, void *user_data);
+  void RemoveProcessor(const std::string &name);
+  bool HasProcessors() const { return processor_count_ > 0; }
+
+  // Called on the camera thread. Runs every processor on |packet|.
+  void Process(media_packet_h packet);
+
+  void SendResult(const std::string &name, std::vector<uint8_t> data);
+
+ private:
+  struct Processor {
+    CameraFrameProcessorCallback callback;
+    void *user_data;
+  };
+
+  FrameProcessorRegistry() = default;
+
+  // Held while processors run, so that a removed processor is never called.
+  std::mutex mutex_;
+  std::map<std::string, Processor> processors_;
+  std::atomic<size_t> processor_count_{0};
+
+  std::unique_ptr<flutter::EventChannel<flutter::EncodableValue>> channel_;
+  // Only accessed on the platform thread.
+  std::unique_ptr<flutter::EventSink<flutter::EncodableValue>> event_sink_;
+};
+
+#endif  // FLUTTER_PLUGIN_FRAME_PROCESSOR_REGISTRY_H_
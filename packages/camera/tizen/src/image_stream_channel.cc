@@ -0,0 +1,248 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "image_stream_channel.h"
+
+#include <flutter/event_stream_handler_functions.h>
+#include <flutter/standard_method_codec.h>
+#include <glib.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "frame_processor_registry.h"
+#include "log.h"
+
+namespace {
+
+constexpr char kChannelName[] = "plugins.flutter.io/camera_tizen/imageStream";
+
+// The number of frames sent to Dart but not yet acknowledged.
+constexpr int kMaxFramesInFlight = 1;
+
+// Buffers for the frames in flight, a pending frame and a frame being copied.
+constexpr size_t kMaxFrames = kMaxFramesInFlight + 2;
+
+}  // namespace
+
+ImageStreamChannel::ImageStreamChannel(flutter::PluginRegistrar *registrar)
+    : state_(std::make_shared<State>()) {
+  channel_ = std::make_unique<flutter::EventChannel<flutter::EncodableValue>>(
+      registrar->messenger(), kChannelName,
+      &flutter::StandardMethodCodec::GetInstance());
+
+  auto handler = std::make_unique<
+      flutter::StreamHandlerFunctions<flutter::EncodableValue>>(
+      [state = state_](
+          const flutter::EncodableValue *arguments,
+          std::unique_ptr<flutter::EventSink<flutter::EncodableValue>> &&events)
+          -> std::unique_ptr<
+              flutter::StreamHandlerError<flutter::EncodableValue>> {
+        state->event_sink = std::move(events);
+        return nullptr;
+      },
+      [state = state_](const flutter::EncodableValue *arguments)
+          -> std::unique_ptr<
+              flutter::StreamHandlerError<flutter::EncodableValue>> {
+        state->event_sink.reset();
+        return nullptr;
+      });
+  channel_->SetStreamHandler(std::move(handler));
+}
+
+ImageStreamChannel::~ImageStreamChannel() {
+  Stop();
+  channel_->SetStreamHandler(nullptr);
+}
+
+void ImageStreamChannel::Start(int max_frame_rate) {
+  LOG_DEBUG("Start image stream, max_frame_rate[%d]", max_frame_rate);
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  state_->credits = kMaxFramesInFlight;
+  if (state_->pending_frame) {
+    ReleaseFrame(*state_, std::move(state_->pending_frame));
+  }
+  if (max_frame_rate > 0) {
+    state_->min_frame_interval =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::seconds(1)) /
+        max_frame_rate;
+  } else {
+    state_->min_frame_interval = std::chrono::steady_clock::duration::zero();
+  }
+  state_->next_frame_time = std::chrono::steady_clock::time_point();
+  state_->streaming = true;
+}
+
+void ImageStreamChannel::Stop() {
+  LOG_DEBUG("Stop image stream");
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  state_->streaming = false;
+  if (state_->pending_frame) {
+    ReleaseFrame(*state_, std::move(state_->pending_frame));
+  }
+}
+
+void ImageStreamChannel::AcknowledgeFrame() {
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  if (state_->pending_frame) {
+    PostFrame(state_, std::move(state_->pending_frame));
+  } else if (state_->credits < kMaxFramesInFlight) {
+    state_->credits++;
+  }
+}
+
+void ImageStreamChannel::OnPreviewPacket(media_packet_h packet) {
+  std::unique_ptr<Frame> frame;
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    std::chrono::steady_clock::duration interval = state_->min_frame_interval;
+    if (interval.count() > 0) {
+      // Tolerate a quarter of the interval of jitter, so that a 30 fps
+      // preview limited to 15 fps yields every other frame.
+      auto now = std::chrono::steady_clock::now();
+      if (now < state_->next_frame_time - interval / 4) {
+        return;
+      }
+      state_->next_frame_time =
+          std::max(state_->next_frame_time + interval, now);
+    }
+    frame = AcquireFrame(*state_);
+  }
+  if (!frame) {
+    return;
+  }
+  bool copied = CopyPacket(packet, *frame);
+
+  std::lock_guard<std::mutex> lock(state_->mutex);
+  if (!copied || !state_->streaming) {
+    ReleaseFrame(*state_, std::move(frame));
+  } else if (state_->credits > 0) {
+    state_->credits--;
+    PostFrame(state_, std::move(frame));
+  } else {
+    // The latest frame wins over a frame still waiting for a credit.
+    if (state_->pending_frame) {
+      ReleaseFrame(*state_, std::move(state_->pending_frame));
+    }
+    state_->pending_frame = std::move(frame);
+  }
+}
+
+void ImageStreamChannel::PostFrame(const std::shared_ptr<State> &state,
+                                   std::unique_ptr<Frame> frame) {
+  struct Param {
+    std::shared_ptr<State> state;
+    std::unique_ptr<Frame> frame;
+  };
+  Param *param = new Param{state, std::move(frame)};
+
+  // Event sinks must be used on the platform thread.
+  g_idle_add_full(
+      G_PRIORITY_DEFAULT,
+      [](gpointer data) -> gboolean {
+        auto *param = static_cast<Param *>(data);
+        State &state = *param->state;
+        bool sent = false;
+        if (state.streaming && state.event_sink) {
+          SendFrame(state, *param->frame);
+          sent = true;
+        }
+
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (!sent && state.credits < kMaxFramesInFlight) {
+          // No acknowledgement will come for this frame.
+          state.credits++;
+        }
+        ReleaseFrame(state, std::move(param->frame));
+        return G_SOURCE_REMOVE;
+      },
+      param, [](gpointer data) { delete static_cast<Param *>(data); });
+}
+
+bool ImageStreamChannel::CopyPacket(media_packet_h packet, Frame &frame) {
+  CameraFrame camera_frame = {};
+  if (!ReadCameraFrame(packet, camera_frame)) {
+    return false;
+  }
+
+  frame.planes.resize(camera_frame.plane_count);
+  for (uint32_t i = 0; i < camera_frame.plane_count; i++) {
+    const CameraFramePlane &source = camera_frame.planes[i];
+    Plane &plane = frame.planes[i];
+    plane.width = source.width;
+    plane.height = source.height;
+    plane.bytes_per_pixel = source.bytes_per_pixel;
+    plane.bytes_per_row = source.bytes_per_row;
+    // The buffer keeps its capacity between frames.
+    plane.bytes.resize(source.size);
+    memcpy(plane.bytes.data(), source.data, source.size);
+  }
+  frame.format = camera_frame.format;
+  frame.width = camera_frame.width;
+  frame.height = camera_frame.height;
+  frame.timestamp = camera_frame.timestamp;
+  return true;
+}
+
+void ImageStreamChannel::SendFrame(State &state, Frame &frame) {
+  // Values are moved rather than listed in initializers, which would copy
+  // the plane buffers.
+  flutter::EncodableList planes;
+  for (Plane &plane : frame.planes) {
+    flutter::EncodableMap plane_map;
+    plane_map[flutter::EncodableValue("bytes")] =
+        flutter::EncodableValue(std::move(plane.bytes));
+    plane_map[flutter::EncodableValue("bytesPerRow")] =
+        flutter::EncodableValue(plane.bytes_per_row);
+    plane_map[flutter::EncodableValue("bytesPerPixel")] =
+        flutter::EncodableValue(plane.bytes_per_pixel);
+    plane_map[flutter::EncodableValue("width")] =
+        flutter::EncodableValue(plane.width);
+    plane_map[flutter::EncodableValue("height")] =
+        flutter::EncodableValue(plane.height);
+    planes.push_back(flutter::EncodableValue(std::move(plane_map)));
+  }
+  flutter::EncodableMap map;
+  map[flutter::EncodableValue("format")] =
+      flutter::EncodableValue(frame.format);
+  map[flutter::EncodableValue("width")] = flutter::EncodableValue(frame.width);
+  map[flutter::EncodableValue("height")] =
+      flutter::EncodableValue(frame.height);
+  map[flutter::EncodableValue("timestamp")] =
+      flutter::EncodableValue(frame.timestamp);
+  map[flutter::EncodableValue("planes")] =
+      flutter::EncodableValue(std::move(planes));
+  flutter::EncodableValue event(std::move(map));
+  state.event_sink->Success(event);
+
+  // The event has been encoded, so take the buffers back for the next frame.
+  auto &event_map = std::get<flutter::EncodableMap>(event);
+  auto &sent_planes = std::get<flutter::EncodableList>(
+      event_map[flutter::EncodableValue("planes")]);
+  for (size_t i = 0; i < frame.planes.size(); i++) {
+    auto &plane_map = std::get<flutter::EncodableMap>(sent_planes[i]);
+    frame.planes[i].bytes = std::move(std::get<std::vector<uint8_t>>(
+        plane_map[flutter::EncodableValue("bytes")]));
+  }
+}
+
+std::unique_ptr<ImageStreamChannel::Frame> ImageStreamChannel::AcquireFrame(
+    State &state) {
+  if (!state.free_frames.empty()) {
+    std::unique_ptr<Frame> frame = std::move(state.free_frames.back());
+    state.free_frames.pop_back();
+    return frame;
+  }
+  if (state.frame_count < kMaxFrames) {
+    state.frame_count++;
+    return std::make_unique<Frame>();
+  }
+  return nullptr;
+}
+
+void ImageStreamChannel::ReleaseFrame(State &state,
+                                      std::unique_ptr<Frame> frame) {
+  state.free_frames.push_back(std::move(frame));
+}
@@ -0,0 +1,98 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_IMAGE_STREAM_CHANNEL_H_
+#define FLUTTER_PLUGIN_IMAGE_STREAM_CHANNEL_H_
+
+#include <flutter/encodable_value.h>
+#include <flutter/event_channel.h>
+#include <flutter/plugin_registrar.h>
+#include <media_packet.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Streams preview frames to Dart over the image stream event channel.
+//
+// Each plane of a preview packet is copied once, on the camera thread, into a
+// buffer taken from a small pool. The buffers are moved into the event and
+// returned to the pool after the event has been sent, so that no memory is
+// allocated per frame.
+//
+// Frames are flow controlled with credits: a frame is only sent when Dart
+// has acknowledged the previous one. Frames that arrive in the meantime
+// replace each other, so that Dart always receives the latest frame.
+class ImageStreamChannel {
+ public:
+  explicit ImageStreamChannel(flutter::PluginRegistrar *registrar);
+  ~ImageStreamChannel();
+
+  // Starts streaming at no more than |max_frame_rate| frames per second, or
+  // at the preview frame rate if |max_frame_rate| is 0.
+  void Start(int max_frame_rate);
+  void Stop();
+  bool IsStreaming() const { return state_->streaming; }
+
+  // Called when Dart has received a frame, which returns its credit.
+  void AcknowledgeFrame();
+
+  // Called on the camera thread. Does not take ownership of |packet|.
+  void OnPreviewPacket(media_packet_h packet);
+
+ private:
+  struct Plane {
+    std::vector<uint8_t> bytes;
+    int bytes_per_row = 0;
+    int bytes_per_pixel = 1;
+    int width = 0;
+    int height = 0;
+  };
+
+  struct Frame {
+    int format = 0;
+    int width = 0;
+    int height = 0;
+    // The presentation timestamp of the packet in nanoseconds.
+    int64_t timestamp = 0;
+    std::vector<Plane> planes;
+  };
+
+  // Shared with the pending main loop callbacks, which may outlive this
+  // object.
+  struct State {
+    std::atomic<bool> streaming{false};
+    // Only accessed on the platform thread.
+    std::unique_ptr<flutter::EventSink<flutter::EncodableValue>> event_sink;
+
+    // The following are guarded by |mutex|.
+    std::mutex mutex;
+    std::vector<std::unique_ptr<Frame>> free_frames;
+    size_t frame_count = 0;
+    // The number of frames that can be sent before an acknowledgement.
+    int credits = 0;
+    // The latest frame waiting for a credit.
+    std::unique_ptr<Frame> pending_frame;
+    std::chrono::steady_clock::duration min_frame_interval{0};
+    std::chrono::steady_clock::time_point next_frame_time;
+  };
+
+  static bool CopyPacket(media_packet_h packet, Frame &frame);
+  static void SendFrame(State &state, Frame &frame);
+  // Must be called with |state->mutex| held.
+  static void PostFrame(const std::shared_ptr<State> &state,
+                        std::unique_ptr<Frame> frame);
+  // Must be called with |state.mutex| held.
+  static std::unique_ptr<Frame> AcquireFrame(State &state);
+  // Must be called with |state.mutex| held.
+  static void ReleaseFrame(State &state, std::unique_ptr<Frame> frame);
+
+  std::shared_ptr<State> state_;
+  std::unique_ptr<flutter::EventChannel<flutter::EncodableValue>> channel_;
+};
+
+#endif  // FLUTTER_PLUGIN_IMAGE_STREAM_CHANNEL_H_
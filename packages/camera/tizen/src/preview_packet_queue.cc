@@ -0,0 +1,95 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "preview_packet_queue.h"
+
+#include <tbm_surface.h>
+
+#include "log.h"
+
+PreviewPacketQueue::PreviewPacketQueue(CameraStatistics &statistics)
+    : statistics_(statistics) {
+  for (Slot &slot : slots_) {
+    slot.queue = this;
+  }
+}
+
+PreviewPacketQueue::~PreviewPacketQueue() { Clear(); }
+
+bool PreviewPacketQueue::Push(media_packet_h packet) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (queued_slot_) {
+    // The previous packet has not been drawn yet, so the new one takes its
+    // slot.
+    media_packet_destroy(queued_slot_->packet);
+    queued_slot_->packet = packet;
+    queued_slot_->queued_time = CameraStatistics::Clock::now();
+    statistics_.OnFrameDropped();
+    return true;
+  }
+  for (Slot &slot : slots_) {
+    if (!slot.packet) {
+      slot.packet = packet;
+      slot.queued_time = CameraStatistics::Clock::now();
+      queued_slot_ = &slot;
+      return true;
+    }
+  }
+  // Every slot is held by the GPU.
+  media_packet_destroy(packet);
+  statistics_.OnFrameDropped();
+  return false;
+}
+
+const FlutterDesktopGpuSurfaceDescriptor *PreviewPacketQueue::Acquire(
+    size_t width, size_t height) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!queued_slot_) {
+    return nullptr;
+  }
+  Slot &slot = *queued_slot_;
+  queued_slot_ = nullptr;
+
+  tbm_surface_h surface = nullptr;
+  int ret = media_packet_get_tbm_surface(slot.packet, &surface);
+  if (ret != MEDIA_PACKET_ERROR_NONE) {
+    LOG_ERROR("media_packet_get_tbm_surface failed, error: %d", ret);
+    FreeSlot(slot);
+    return nullptr;
+  }
+  slot.in_use = true;
+  slot.descriptor.handle = surface;
+  slot.descriptor.width = width;
+  slot.descriptor.height = height;
+  slot.descriptor.release_callback = OnSurfaceReleased;
+  slot.descriptor.release_context = &slot;
+  statistics_.OnFramePresented(CameraStatistics::Clock::now() -
+                               slot.queued_time);
+  return &slot.descriptor;
+}
+
+void PreviewPacketQueue::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (Slot &slot : slots_) {
+    FreeSlot(slot);
+  }
+  queued_slot_ = nullptr;
+}
+
+void PreviewPacketQueue::OnSurfaceReleased(void *release_context) {
+  auto *slot = static_cast<Slot *>(release_context);
+  std::lock_guard<std::mutex> lock(slot->queue->mutex_);
+  // The packet may have been destroyed by Clear() already.
+  if (slot->in_use) {
+    FreeSlot(*slot);
+  }
+}
+
+void PreviewPacketQueue::FreeSlot(Slot &slot) {
+  if (slot.packet) {
+    media_packet_destroy(slot.packet);
+    slot.packet = nullptr;
+  }
+  slot.in_use = false;
+}
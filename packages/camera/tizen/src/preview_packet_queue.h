@@ -0,0 +1,66 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_PREVIEW_PACKET_QUEUE_H_
+#define FLUTTER_PLUGIN_PREVIEW_PACKET_QUEUE_H_
+
+#include <flutter/texture_registrar.h>
+#include <media_packet.h>
+
+#include <array>
+#include <mutex>
+
+#include "camera_statistics.h"
+
+// A small ring of preview packets shared between the camera thread, which
+// produces them, and the raster thread, which draws them.
+//
+// A packet handed to the GPU stays alive until the engine calls the release
+// callback of its surface descriptor, even if newer packets arrive in the
+// meantime. Only the latest packet waits to be drawn: a packet that has not
+// been drawn when the next one arrives is dropped and counted in the
+// statistics.
+class PreviewPacketQueue {
+ public:
+  explicit PreviewPacketQueue(CameraStatistics &statistics);
+  ~PreviewPacketQueue();
+
+  // Called on the camera thread. Takes ownership of |packet|. Returns true if
+  // the packet is queued and the texture should be marked as available.
+  bool Push(media_packet_h packet);
+
+  // Called on the raster thread. Returns a descriptor for the latest packet,
+  // or nullptr if no packet is queued.
+  const FlutterDesktopGpuSurfaceDescriptor *Acquire(size_t width,
+                                                    size_t height);
+
+  // Destroys every packet, including those still held by the GPU.
+  void Clear();
+
+ private:
+  // One queued packet and up to three packets held by the GPU.
+  static constexpr size_t kSlotCount = 4;
+
+  struct Slot {
+    PreviewPacketQueue *queue = nullptr;
+    media_packet_h packet = nullptr;
+    bool in_use = false;
+    CameraStatistics::Clock::time_point queued_time;
+    FlutterDesktopGpuSurfaceDescriptor descriptor = {};
+  };
+
+  static void OnSurfaceReleased(void *release_context);
+
+  // Must be called with |mutex_| held.
+  static void FreeSlot(Slot &slot);
+
+  CameraStatistics &statistics_;
+
+  std::mutex mutex_;
+  std::array<Slot, kSlotCount> slots_;
+  // The slot of the packet waiting to be drawn, if any.
+  Slot *queued_slot_ = nullptr;
+};
+
+#endif  // FLUTTER_PLUGIN_PREVIEW_PACKET_QUEUE_H_
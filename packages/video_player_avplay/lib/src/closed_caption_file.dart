@@ -2,7 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
-import 'dart:typed_data' show Uint8List;
+import 'dart:typed_data' show ByteData, Endian, Uint8List;
 import 'package:flutter/foundation.dart'
     show immutable, listEquals, objectRuntimeType;
 import 'package:flutter/material.dart';
@@ -672,6 +672,65 @@ class SubtitleAttribute {
     return subtitleAttributes;
   }
 
+  /// Parse a subtitle attribute list from the packed attribute records which
+  /// given by eventListener when the `packedSubtitleAttributes` player option
+  /// is enabled.
+  ///
+  /// Each record is 16 bytes in little-endian order: the attribute type
+  /// (uint8), the value kind (uint8), two reserved bytes, the start time
+  /// (uint32), the stop time (uint32) and the value (float32, int32, uint32
+  /// or an index into [strings]).
+  static List<SubtitleAttribute> fromPackedSubtitleAttributes(
+    Uint8List packedAttributes,
+    List<Object?>? strings,
+  ) {
+    const int recordSize = 16;
+    final List<SubtitleAttribute> subtitleAttributes = <SubtitleAttribute>[];
+    final ByteData data = ByteData.sublistView(packedAttributes);
+
+    for (int offset = 0;
+        offset + recordSize <= data.lengthInBytes;
+        offset += recordSize) {
+      final int attrTypeNum = data.getUint8(offset);
+      if (attrTypeNum >= SubtitleAttrType.values.length) {
+        continue;
+      }
+
+      final Object attrValue;
+      switch (data.getUint8(offset + 1)) {
+        case _packedValueFloat:
+          attrValue = data.getFloat32(offset + 12, Endian.little);
+        case _packedValueInt:
+          attrValue = data.getInt32(offset + 12, Endian.little);
+        case _packedValueUint:
+          attrValue = data.getUint32(offset + 12, Endian.little);
+        case _packedValueString:
+          final int index = data.getUint32(offset + 12, Endian.little);
+          if (strings == null || index >= strings.length) {
+            continue;
+          }
+          attrValue = strings[index]! as String;
+        default:
+          continue;
+      }
+
+      subtitleAttributes.add(
+        SubtitleAttribute(
+          attrType: SubtitleAttrType.values[attrTypeNum],
+          startTime: data.getUint32(offset + 4, Endian.little),
+          stopTime: data.getUint32(offset + 8, Endian.little),
+          attrValue: attrValue,
+        ),
+      );
+    }
+    return subtitleAttributes;
+  }
+
+  static const int _packedValueFloat = 1;
+  static const int _packedValueInt = 2;
+  static const int _packedValueUint = 3;
+  static const int _packedValueString = 4;
+
   @override
   String toString() {
     return '${objectRuntimeType(this, 'SubtitleAttribute')}('
@@ -743,11 +802,15 @@ class Captions {
           final Map<Object?, Object?> textInfo =
               subtitlesInfo.textsInfo![i] as Map<Object?, Object?>;
           final String? text = textInfo['text'] as String?;
-          final List<dynamic>? subtitleAttrList =
-              textInfo['attributes'] as List<dynamic>?;
+          final Object? packedAttributes = textInfo['packedAttributes'];
 
           final List<SubtitleAttribute> subtitleAttributes =
-              SubtitleAttribute.fromEventSubtitleAttrList(subtitleAttrList);
+              packedAttributes is Uint8List
+                  ? SubtitleAttribute.fromPackedSubtitleAttributes(
+                      packedAttributes,
+                      textInfo['attributeStrings'] as List<Object?>?)
+                  : SubtitleAttribute.fromEventSubtitleAttrList(
+                      textInfo['attributes'] as List<dynamic>?);
 
           final (
             TextOriginAndExtent?,
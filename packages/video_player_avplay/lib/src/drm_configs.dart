@@ -26,6 +26,9 @@ class DrmConfigs {
     this.type = DrmType.none,
     this.licenseServerUrl,
     this.licenseCallback,
+    this.licenseConnectionIdleTimeout,
+    this.licenseCacheMaxAge,
+    this.persistLicenseCache = false,
   })  : assert(
           (licenseServerUrl != null) ^ (licenseCallback != null),
           'Either licenseServerUrl or licenseCallback should be specified, but not both.',
@@ -55,11 +58,57 @@ class DrmConfigs {
   /// hang or fail to process user input.
   final LicenseCallback? licenseCallback;
 
+  /// How long an idle connection to the license server is kept open so that
+  /// subsequent license requests can reuse it.
+  ///
+  /// This is optional and only used with [licenseServerUrl]. Reusing the
+  /// connection avoids repeated DNS, TCP and TLS handshakes when licenses are
+  /// requested frequently, e.g. on key rotation in live streams. Setting
+  /// [Duration.zero] disables connection reuse. The timeout is rounded up to
+  /// whole seconds.
+  ///
+  /// The connection pool is shared by all players in the process, so the
+  /// timeout set by the most recently created player applies to every
+  /// player.
+  final Duration? licenseConnectionIdleTimeout;
+
+  /// How long a license response is cached and reused for the same content
+  /// keys.
+  ///
+  /// This is optional and caching is disabled if not set. When the same
+  /// content is opened again (e.g. zapping back to a channel), the cached
+  /// license is installed without contacting the license server or calling
+  /// [licenseCallback]. A cached license rejected by the DRM system is
+  /// discarded and a new one is requested. Do not set a value longer than
+  /// the validity of the licenses issued by the license server.
+  final Duration? licenseCacheMaxAge;
+
+  /// Whether cached license responses are also stored, encrypted, in the app
+  /// data directory so that they survive app restarts.
+  ///
+  /// This has no effect if [licenseCacheMaxAge] is not set.
+  final bool persistLicenseCache;
+
   /// Converts to a map.
   Map<String, Object?> toMap() {
     return <String, Object?>{
       'drmType': type.index,
       'licenseServerUrl': licenseServerUrl,
+      'licenseConnectionIdleTimeout': _inSecondsRoundedUp(
+        licenseConnectionIdleTimeout,
+      ),
+      'licenseCacheMaxAge': licenseCacheMaxAge?.inSeconds,
+      'persistLicenseCache': persistLicenseCache,
     };
   }
+
+  /// Converts [duration] to whole seconds, so that a sub-second timeout does
+  /// not become zero.
+  static int? _inSecondsRoundedUp(Duration? duration) {
+    if (duration == null) {
+      return null;
+    }
+    return (duration.inMicroseconds + Duration.microsecondsPerSecond - 1) ~/
+        Duration.microsecondsPerSecond;
+  }
 }
@@ -27,6 +27,38 @@ class VideoPlayerTizen extends VideoPlayerPlatform {
 
   @override
   Future<int?> create(DataSource dataSource) async {
+    final PlayerMessage response =
+        await _api.create(_createMessage(dataSource));
+    return response.playerId;
+  }
+
+  @override
+  Future<bool> preload(DataSource dataSource) {
+    return _api.preload(_createMessage(dataSource));
+  }
+
+  @override
+  Future<void> releasePreloadedPlayers() {
+    return _api.releasePreloadedPlayers();
+  }
+
+  @override
+  Future<Map<String, int>> getAbrTelemetry(int playerId) {
+    return _api.getAbrTelemetry(playerId);
+  }
+
+  @override
+  Future<Map<String, Duration>> getStartupReport(int playerId) async {
+    final Map<String, int> report = await _api.getStartupReport(playerId);
+    return report.map(
+      (String stage, int microseconds) => MapEntry<String, Duration>(
+        stage,
+        Duration(microseconds: microseconds),
+      ),
+    );
+  }
+
+  CreateMessage _createMessage(DataSource dataSource) {
     final CreateMessage message = CreateMessage();
 
     switch (dataSource.sourceType) {
@@ -51,9 +83,7 @@ class VideoPlayerTizen extends VideoPlayerPlatform {
       case DataSourceType.contentUri:
         message.uri = dataSource.uri;
     }
-
-    final PlayerMessage response = await _api.create(message);
-    return response.playerId;
+    return message;
   }
 
   @override
@@ -210,6 +240,14 @@ class VideoPlayerTizen extends VideoPlayerPlatform {
     return Duration(milliseconds: response.position);
   }
 
+  @override
+  Future<Duration> getEstimatedPosition(int playerId) async {
+    final PositionMessage response = await _api.estimatedPosition(
+      PlayerMessage(playerId: playerId),
+    );
+    return Duration(milliseconds: response.position);
+  }
+
   @override
   Future<String> getStreamingProperty(
     int playerId,
@@ -332,6 +370,21 @@ class VideoPlayerTizen extends VideoPlayerPlatform {
     return _api.updateDashToken(playerId, dashToken);
   }
 
+  @override
+  Future<bool> prefetchLicense(
+    String uri,
+    int drmType,
+    String licenseServerUrl,
+    Duration licenseCacheMaxAge,
+  ) {
+    return _api.prefetchLicense(
+      uri,
+      drmType,
+      licenseServerUrl,
+      licenseCacheMaxAge.inSeconds,
+    );
+  }
+
   @override
   Future<List<Track>> getActiveTrackInfo(int playerId) async {
     final TrackMessage msg = await _api.getActiveTrackInfo(
@@ -439,7 +492,8 @@ class VideoPlayerTizen extends VideoPlayerPlatform {
             subtitlesInfo: SubtitlesInfo(
                 map['duration'] as int?,
                 map['textsInfo'] as List<dynamic>?,
-                map['pictureInfo'] as Map<Object?, Object?>?),
+                map['pictureInfo'] as Map<Object?, Object?>?,
+                sequence: map['sequence'] as int?),
           );
         case 'isPlayingStateUpdate':
           return VideoEvent(
@@ -456,6 +510,11 @@ class VideoPlayerTizen extends VideoPlayerPlatform {
             eventType: VideoEventType.manifestInfoUpdated,
             manifestInfo: map['manifestInfo'] as String?,
           );
+        case 'positionUpdate':
+          return VideoEvent(
+            eventType: VideoEventType.positionUpdate,
+            position: Duration(milliseconds: map['position']! as int),
+          );
         default:
           return VideoEvent(eventType: VideoEventType.unknown);
       }
@@ -450,6 +450,23 @@ class VideoPlayerController extends ValueNotifier<VideoPlayerValue> {
 
   /// Player Options used for add additional parameters.
   /// Only for [VideoPlayerController.network].
+  ///
+  /// Set `'packedSubtitleAttributes'` to `true` to receive text subtitle
+  /// attributes as packed binary records instead of one map per attribute,
+  /// which reduces the cost of styled subtitles. The parsed captions are the
+  /// same in either case.
+  ///
+  /// Set `'positionUpdateInterval'` to a positive number of milliseconds to
+  /// have the player push the playback position at that interval while
+  /// playing, extrapolated from occasional samples of the player. By default
+  /// the position is polled.
+  ///
+  /// Set `'segmentCache'` to `true` to fetch HLS and DASH streams through a
+  /// local caching proxy, which keeps recently played segments in memory
+  /// (`'segmentCacheSize'` bytes, 64 MiB by default) and downloads the next
+  /// `'segmentPrefetchCount'` segments (2 by default) ahead of the player.
+  /// The proxy is shared by all players and configured by the first player
+  /// that enables it.
   final Map<String, dynamic>? playerOptions;
 
   /// Sets specific feature values for HTTP, MMS, or specific streaming engine (Smooth Streaming, HLS, DASH, DivX Plus Streaming, or Widevine).
@@ -482,6 +499,7 @@ class VideoPlayerController extends ValueNotifier<VideoPlayerValue> {
   Timer? _timer;
   Timer? _durationTimer;
   bool _isDisposed = false;
+  int _lastSubtitleSequence = -1;
   Completer<void>? _creatingCompleter;
   StreamSubscription<dynamic>? _eventSubscription;
   _VideoAppLifeCycleObserver? _lifeCycleObserver;
@@ -584,6 +602,7 @@ class VideoPlayerController extends ValueNotifier<VideoPlayerValue> {
 
     _playerId = (await _videoPlayerPlatform.create(dataSourceDescription)) ??
         kUninitializedPlayerId;
+    _lastSubtitleSequence = -1;
     _creatingCompleter!.complete(null);
     final Completer<void> initializingCompleter = Completer<void>();
 
@@ -643,6 +662,14 @@ class VideoPlayerController extends ValueNotifier<VideoPlayerValue> {
         case VideoEventType.bufferingEnd:
           value = value.copyWith(isBuffering: false);
         case VideoEventType.subtitleUpdate:
+          final int? sequence = event.subtitlesInfo!.sequence;
+          if (sequence != null) {
+            if (sequence < _lastSubtitleSequence) {
+              // Superseded by an update that has already been shown.
+              break;
+            }
+            _lastSubtitleSequence = sequence;
+          }
           final Captions? captions =
               Captions.parseSubtitle(value.position, event.subtitlesInfo!);
           value = value.copyWith(captions: captions);
@@ -662,6 +689,8 @@ class VideoPlayerController extends ValueNotifier<VideoPlayerValue> {
           value = value.copyWith(adInfo: adInfo);
         case VideoEventType.manifestInfoUpdated:
           value = value.copyWith(manifestInfo: event.manifestInfo);
+        case VideoEventType.positionUpdate:
+          _updatePosition(event.position!);
         case VideoEventType.unknown:
           break;
       }
@@ -835,14 +864,33 @@ class VideoPlayerController extends ValueNotifier<VideoPlayerValue> {
   }
 
   /// The position in the current video.
+  ///
+  /// If position updates are enabled (see [playerOptions]), this returns the
+  /// position estimated by the platform, which does not query the player.
   Future<Duration?> get position async {
+    if (_receivesPositionUpdates) {
+      if (_isDisposedOrNotInitialized) {
+        return null;
+      }
+      return _videoPlayerPlatform.getEstimatedPosition(_playerId);
+    }
     if (_isDisposed || _timer == null) {
       return null;
     }
     return _videoPlayerPlatform.getPosition(_playerId);
   }
 
-  Timer _createTimer() {
+  /// Whether the platform pushes position updates, in which case the position
+  /// is not polled.
+  bool get _receivesPositionUpdates {
+    final Object? interval = playerOptions?['positionUpdateInterval'];
+    return interval is int && interval > 0;
+  }
+
+  Timer? _createTimer() {
+    if (_receivesPositionUpdates) {
+      return null;
+    }
     return Timer.periodic(const Duration(milliseconds: 500), (
       Timer timer,
     ) async {
@@ -1089,6 +1137,112 @@ class VideoPlayerController extends ValueNotifier<VideoPlayerValue> {
     return _videoPlayerPlatform.updateDashToken(playerId, dashToken);
   }
 
+  /// Acquires the DRM licenses of [dataSource] before a player is created
+  /// for it, e.g. for the channel the user is likely to watch next.
+  ///
+  /// The licenses are requested from [DrmConfigs.licenseServerUrl] of
+  /// [drmConfigs] and cached for [DrmConfigs.licenseCacheMaxAge] (5 minutes
+  /// if not set). A [VideoPlayerController] created later for the same
+  /// content and license server installs the cached licenses instead of
+  /// requesting them again. Only PlayReady content is supported.
+  ///
+  /// Returns `true` if the license request was started, `false` otherwise.
+  static Future<bool> prefetchLicense(
+    String dataSource,
+    DrmConfigs drmConfigs,
+  ) {
+    if (drmConfigs.type != DrmType.playready ||
+        drmConfigs.licenseServerUrl == null) {
+      return Future<bool>.value(false);
+    }
+    return _videoPlayerPlatform.prefetchLicense(
+      dataSource,
+      drmConfigs.type.index,
+      drmConfigs.licenseServerUrl!,
+      drmConfigs.licenseCacheMaxAge ?? const Duration(minutes: 5),
+    );
+  }
+
+  /// Prepares a player for the network video at [dataSource] before a
+  /// [VideoPlayerController] is created for it, e.g. for the channels next to
+  /// the current channel.
+  ///
+  /// The arguments are the same as those of [VideoPlayerController.network].
+  /// The prepared player does not use a video decoder until a
+  /// [VideoPlayerController.network] for the same [dataSource] and with the
+  /// same arguments is initialized, which then starts from the buffered data
+  /// instead of opening the stream again. If the arguments differ, or the
+  /// prepared player cannot be used, the stream is opened again as usual.
+  /// Dispose the controller that is currently playing
+  /// before initializing the next one, because only one player can use the
+  /// video decoder at a time.
+  ///
+  /// Up to two players are kept. When another video is preloaded, the least
+  /// recently preloaded player is released.
+  ///
+  /// Returns `true` if a player was prepared, `false` otherwise.
+  static Future<bool> preload(
+    String dataSource, {
+    VideoFormat? formatHint,
+    Map<String, String> httpHeaders = const <String, String>{},
+    DrmConfigs? drmConfigs,
+    Map<String, dynamic>? playerOptions,
+    Map<StreamingPropertyType, String>? streamingProperty,
+  }) {
+    return _videoPlayerPlatform.preload(
+      DataSource(
+        sourceType: DataSourceType.network,
+        uri: dataSource,
+        formatHint: formatHint,
+        httpHeaders: httpHeaders,
+        drmConfigs: drmConfigs,
+        playerOptions: playerOptions,
+        streamingProperty: streamingProperty,
+      ),
+    );
+  }
+
+  /// Releases all players prepared by [preload].
+  static Future<void> releasePreloadedPlayers() {
+    return _videoPlayerPlatform.releasePreloadedPlayers();
+  }
+
+  /// Returns the time elapsed from the creation of the player until each
+  /// start-up stage was reached.
+  ///
+  /// The possible stages are `opened`, `drmSessionCreated`,
+  /// `licenseRequested`, `licenseReceived`, `licenseInstalled`,
+  /// `prepareStarted`, `prepared`, `initialized` and `playing`. Stages that
+  /// have not been reached (e.g. the DRM stages of a clear stream) are not
+  /// included.
+  ///
+  /// Set the `logStartupReport` option of [playerOptions] to `true` to also
+  /// write the timeline to the platform log when playback starts.
+  Future<Map<String, Duration>> getStartupReport() async {
+    if (_isDisposedOrNotInitialized) {
+      return <String, Duration>{};
+    }
+    return _videoPlayerPlatform.getStartupReport(playerId);
+  }
+
+  /// Returns the adaptive streaming telemetry collected by the player.
+  ///
+  /// Throughputs and bitrates are in bits per second: `lastThroughput`,
+  /// `averageThroughput`, `segmentCount`, `currentBitrate`,
+  /// `bitrateSwitchCount`, `bufferLevel` (percent), `rebufferCount` and
+  /// `maxBandwidth` (the cap applied by the ABR policy, 0 if none).
+  ///
+  /// The ABR policy is chosen with the `abrPolicy` option of [playerOptions]:
+  /// `'throughput'` caps the bitrate below the measured throughput after
+  /// rebuffering and lifts the cap again while the buffer stays full, and
+  /// `'fixed'` caps the bitrate at the `abrBitrate` option.
+  Future<Map<String, int>> getAbrTelemetry() async {
+    if (_isDisposedOrNotInitialized) {
+      return <String, int>{};
+    }
+    return _videoPlayerPlatform.getAbrTelemetry(playerId);
+  }
+
   /// Get activated(selected) track infomation of the associated media.
   Future<List<Track>> getActiveTrackInfo() async {
     if (_isDisposedOrNotInitialized) {
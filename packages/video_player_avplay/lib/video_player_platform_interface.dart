@@ -127,6 +127,13 @@ abstract class VideoPlayerPlatform extends PlatformInterface {
     throw UnimplementedError('getPosition() has not been implemented.');
   }
 
+  /// Gets the video position estimated by the platform from the last known
+  /// position and the playback speed, without querying the player.
+  Future<Duration> getEstimatedPosition(int playerId) {
+    throw UnimplementedError(
+        'getEstimatedPosition() has not been implemented.');
+  }
+
   /// Gets the video duration as [DurationRange].
   Future<DurationRange> getDuration(int playerId) {
     throw UnimplementedError('getDuration() has not been implemented.');
@@ -175,6 +182,38 @@ abstract class VideoPlayerPlatform extends PlatformInterface {
     throw UnimplementedError('updateDashToken() has not been implemented.');
   }
 
+  /// Acquires and caches the DRM licenses of [uri] ahead of playback.
+  Future<bool> prefetchLicense(
+    String uri,
+    int drmType,
+    String licenseServerUrl,
+    Duration licenseCacheMaxAge,
+  ) {
+    throw UnimplementedError('prefetchLicense() has not been implemented.');
+  }
+
+  /// Prepares a player for [dataSource] ahead of playback.
+  Future<bool> preload(DataSource dataSource) {
+    throw UnimplementedError('preload() has not been implemented.');
+  }
+
+  /// Releases all players prepared by [preload].
+  Future<void> releasePreloadedPlayers() {
+    throw UnimplementedError(
+        'releasePreloadedPlayers() has not been implemented.');
+  }
+
+  /// Returns the time elapsed from the creation of the player until each
+  /// start-up stage was reached.
+  Future<Map<String, Duration>> getStartupReport(int playerId) {
+    throw UnimplementedError('getStartupReport() has not been implemented.');
+  }
+
+  /// Returns the adaptive streaming telemetry collected by the player.
+  Future<Map<String, int>> getAbrTelemetry(int playerId) {
+    throw UnimplementedError('getAbrTelemetry() has not been implemented.');
+  }
+
   /// Get activated(selected) track infomation of the associated media.
   Future<List<Track>> getActiveTrackInfo(int playerId) {
     throw UnimplementedError('getActiveTrackInfo() has not been implemented.');
@@ -532,6 +571,7 @@ class VideoEvent {
     this.adInfo,
     this.manifestInfo,
     this.subtitlesInfo,
+    this.position,
   });
 
   /// The type of the event.
@@ -572,6 +612,11 @@ class VideoEvent {
   /// Only used if [eventType] is [VideoEventType.subtitleUpdate].
   final SubtitlesInfo? subtitlesInfo;
 
+  /// The current playback position.
+  ///
+  /// Only used if [eventType] is [VideoEventType.positionUpdate].
+  final Duration? position;
+
   @override
   bool operator ==(Object other) {
     return identical(this, other) ||
@@ -584,7 +629,8 @@ class VideoEvent {
             isPlaying == other.isPlaying &&
             mapEquals(adInfo, other.adInfo) &&
             manifestInfo == other.manifestInfo &&
-            subtitlesInfo == other.subtitlesInfo;
+            subtitlesInfo == other.subtitlesInfo &&
+            position == other.position;
   }
 
   @override
@@ -596,7 +642,8 @@ class VideoEvent {
       isPlaying.hashCode ^
       adInfo.hashCode ^
       manifestInfo.hashCode ^
-      subtitlesInfo.hashCode;
+      subtitlesInfo.hashCode ^
+      position.hashCode;
 }
 
 /// Type of the event.
@@ -637,6 +684,9 @@ enum VideoEventType {
   /// The manifest updated in dash.
   manifestInfoUpdated,
 
+  /// The playback position has been updated.
+  positionUpdate,
+
   /// An unknown event has been received.
   unknown,
 }
@@ -710,7 +760,8 @@ class DurationRange {
 @immutable
 class SubtitlesInfo {
   /// Creates an instance of [SubtitlesInfo].
-  const SubtitlesInfo(this.textDuration, this.textsInfo, this.pictureInfo);
+  const SubtitlesInfo(this.textDuration, this.textsInfo, this.pictureInfo,
+      {this.sequence});
 
   /// The duration of text.
   final int? textDuration;
@@ -721,18 +772,28 @@ class SubtitlesInfo {
   /// Subtitle picture info of the video. Includes the picture and its width and height.
   final Map<Object?, Object?>? pictureInfo;
 
+  /// The order in which the subtitle update was produced.
+  ///
+  /// Picture subtitles are encoded asynchronously and may be delivered after
+  /// a later update. Such updates should be ignored.
+  final int? sequence;
+
   @override
   bool operator ==(Object other) {
     return identical(this, other) ||
         other is SubtitlesInfo &&
             listEquals(textsInfo, other.textsInfo) &&
             textDuration == other.textDuration &&
-            mapEquals(pictureInfo, other.pictureInfo);
+            mapEquals(pictureInfo, other.pictureInfo) &&
+            sequence == other.sequence;
   }
 
   @override
   int get hashCode =>
-      textDuration.hashCode ^ textsInfo.hashCode ^ pictureInfo.hashCode;
+      textDuration.hashCode ^
+      textsInfo.hashCode ^
+      pictureInfo.hashCode ^
+      sequence.hashCode;
 }
 
 /// [VideoPlayerOptions] can be optionally used to set additional player settings
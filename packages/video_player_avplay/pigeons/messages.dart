@@ -175,4 +175,15 @@ abstract class VideoPlayerAvplayApi {
   DashPropertyMapMessage getData(DashPropertyTypeListMessage msg);
   bool updateDashToken(int playerId, String dashToken);
   TrackMessage getActiveTrackInfo(PlayerMessage msg);
+  bool prefetchLicense(
+    String uri,
+    int drmType,
+    String licenseServerUrl,
+    int licenseCacheMaxAge,
+  );
+  bool preload(CreateMessage msg);
+  void releasePreloadedPlayers();
+  Map<String, int> getStartupReport(int playerId);
+  PositionMessage estimatedPosition(PlayerMessage msg);
+  Map<String, int> getAbrTelemetry(int playerId);
 }
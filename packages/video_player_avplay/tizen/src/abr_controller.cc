@@ -0,0 +1,225 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "abr_controller.h"
+
+#include <cstdlib>
+
+#include "log.h"
+#include "video_player.h"
+
+namespace video_player_avplay_tizen {
+
+namespace {
+
+// The weight of a new segment in the moving average of the throughput.
+constexpr double kThroughputSmoothing = 0.3;
+
+// The fraction of the throughput that may be used by the video when capped,
+// leaving room for audio, subtitles and throughput variation.
+constexpr double kSafetyFactor = 0.7;
+
+// The buffer level in percent under which the bitrate is capped.
+constexpr int32_t kLowBufferLevel = 20;
+
+// The number of segments downloaded with a full buffer before the cap is
+// raised by kRaiseFactor.
+constexpr int64_t kHealthySegmentsToRaise = 10;
+constexpr double kRaiseFactor = 1.5;
+
+// Changes of the cap smaller than this fraction are not applied, to avoid
+// reconfiguring the player on every segment.
+constexpr double kMinCapChange = 0.1;
+
+}  // namespace
+
+int64_t ThroughputAbrPolicy::GetMaxBandwidth(const AbrTelemetry &telemetry) {
+  int64_t budget =
+      static_cast<int64_t>(telemetry.average_throughput * kSafetyFactor);
+  // The buffer is low while it is initially filled, which is not a sign of
+  // congestion.
+  bool is_starving =
+      telemetry.rebuffer_count > last_rebuffer_count_ ||
+      (telemetry.playback_started && telemetry.buffer_level < kLowBufferLevel);
+  last_rebuffer_count_ = telemetry.rebuffer_count;
+
+  if (is_starving) {
+    healthy_segment_count_ = 0;
+    if (budget > 0 && (max_bandwidth_ == 0 || budget < max_bandwidth_)) {
+      max_bandwidth_ = budget;
+    }
+    return max_bandwidth_;
+  }
+
+  if (max_bandwidth_ == 0 || telemetry.buffer_level < 100) {
+    return max_bandwidth_;
+  }
+  if (telemetry.segment_count != last_segment_count_) {
+    last_segment_count_ = telemetry.segment_count;
+    healthy_segment_count_++;
+  }
+  if (healthy_segment_count_ >= kHealthySegmentsToRaise) {
+    healthy_segment_count_ = 0;
+    max_bandwidth_ = static_cast<int64_t>(max_bandwidth_ * kRaiseFactor);
+    if (max_bandwidth_ >= telemetry.average_throughput) {
+      max_bandwidth_ = 0;
+    }
+  }
+  return max_bandwidth_;
+}
+
+AbrController::AbrController(std::unique_ptr<AbrPolicy> policy,
+                             MaxBandwidthSetter max_bandwidth_setter)
+    : policy_(std::move(policy)),
+      max_bandwidth_setter_(std::move(max_bandwidth_setter)) {}
+
+std::unique_ptr<AbrPolicy> AbrController::CreatePolicy(
+    const flutter::EncodableMap *player_options) {
+  std::string policy =
+      flutter_common::GetValue(player_options, "abrPolicy", std::string());
+  if (policy == "throughput") {
+    return std::make_unique<ThroughputAbrPolicy>();
+  } else if (policy == "fixed") {
+    int64_t bitrate =
+        flutter_common::GetIntegerValue(player_options, "abrBitrate", 0);
+    if (bitrate > 0) {
+      return std::make_unique<FixedBitratePolicy>(bitrate);
+    }
+    LOG_ERROR("[AbrController] abrBitrate is required by the fixed policy.");
+  } else if (!policy.empty()) {
+    LOG_ERROR("[AbrController] Unknown ABR policy: %s", policy.c_str());
+  }
+  return nullptr;
+}
+
+void AbrController::OnSegmentDownloaded(int64_t throughput) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (throughput <= 0) {
+      return;
+    }
+    telemetry_.last_throughput = throughput;
+    if (telemetry_.average_throughput == 0) {
+      telemetry_.average_throughput = throughput;
+    } else {
+      telemetry_.average_throughput = static_cast<int64_t>(
+          telemetry_.average_throughput * (1 - kThroughputSmoothing) +
+          throughput * kThroughputSmoothing);
+    }
+    telemetry_.segment_count++;
+    if (!UpdatePolicy()) {
+      return;
+    }
+  }
+  ApplyMaxBandwidth();
+}
+
+void AbrController::OnBitrateChanged(int64_t bitrate) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (bitrate <= 0 || bitrate == telemetry_.current_bitrate) {
+    return;
+  }
+  if (telemetry_.current_bitrate != 0) {
+    telemetry_.bitrate_switch_count++;
+  }
+  telemetry_.current_bitrate = bitrate;
+}
+
+void AbrController::OnBufferLevelChanged(int32_t buffer_level) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    telemetry_.buffer_level = buffer_level;
+    if (!UpdatePolicy()) {
+      return;
+    }
+  }
+  ApplyMaxBandwidth();
+}
+
+void AbrController::OnPlaybackStarted() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  telemetry_.playback_started = true;
+}
+
+void AbrController::OnRebufferingStarted() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!telemetry_.playback_started) {
+      return;
+    }
+    telemetry_.rebuffer_count++;
+    if (!UpdatePolicy()) {
+      return;
+    }
+  }
+  ApplyMaxBandwidth();
+}
+
+flutter::EncodableMap AbrController::GetTelemetry() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return flutter::EncodableMap{
+      {flutter::EncodableValue("lastThroughput"),
+       flutter::EncodableValue(telemetry_.last_throughput)},
+      {flutter::EncodableValue("averageThroughput"),
+       flutter::EncodableValue(telemetry_.average_throughput)},
+      {flutter::EncodableValue("segmentCount"),
+       flutter::EncodableValue(telemetry_.segment_count)},
+      {flutter::EncodableValue("currentBitrate"),
+       flutter::EncodableValue(telemetry_.current_bitrate)},
+      {flutter::EncodableValue("bitrateSwitchCount"),
+       flutter::EncodableValue(telemetry_.bitrate_switch_count)},
+      {flutter::EncodableValue("bufferLevel"),
+       flutter::EncodableValue(
+           static_cast<int64_t>(telemetry_.buffer_level))},
+      {flutter::EncodableValue("rebufferCount"),
+       flutter::EncodableValue(telemetry_.rebuffer_count)},
+      {flutter::EncodableValue("maxBandwidth"),
+       flutter::EncodableValue(telemetry_.max_bandwidth)},
+  };
+}
+
+bool AbrController::UpdatePolicy() {
+  if (!policy_) {
+    return false;
+  }
+  int64_t max_bandwidth = policy_->GetMaxBandwidth(telemetry_);
+  int64_t current = target_max_bandwidth_;
+  if (max_bandwidth == current) {
+    return false;
+  }
+  if (max_bandwidth != 0 && current != 0 &&
+      std::abs(max_bandwidth - current) < current * kMinCapChange) {
+    return false;
+  }
+  target_max_bandwidth_ = max_bandwidth;
+  return true;
+}
+
+void AbrController::ApplyMaxBandwidth() {
+  std::lock_guard<std::mutex> apply_lock(apply_mutex_);
+  int64_t max_bandwidth, current;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    max_bandwidth = target_max_bandwidth_;
+    current = telemetry_.max_bandwidth;
+  }
+  if (max_bandwidth == current) {
+    return;
+  }
+  if (!max_bandwidth_setter_(max_bandwidth)) {
+    LOG_ERROR("[AbrController] Fail to set max bandwidth.");
+    // Let the policy decide again on the next update.
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (target_max_bandwidth_ == max_bandwidth) {
+      target_max_bandwidth_ = current;
+    }
+    return;
+  }
+  LOG_INFO("[AbrController] Max bandwidth: %lld -> %lld", current,
+           max_bandwidth);
+  std::lock_guard<std::mutex> lock(mutex_);
+  telemetry_.max_bandwidth = max_bandwidth;
+}
+
+}  // namespace video_player_avplay_tizen
@@ -0,0 +1,126 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_ABR_CONTROLLER_H_
+#define FLUTTER_PLUGIN_ABR_CONTROLLER_H_
+
+#include <flutter/encodable_value.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace video_player_avplay_tizen {
+
+// Adaptive streaming telemetry of a player. Bitrates and throughputs are in
+// bits per second.
+struct AbrTelemetry {
+  // The throughput measured for the last downloaded segment, and its
+  // exponentially weighted moving average.
+  int64_t last_throughput = 0;
+  int64_t average_throughput = 0;
+  int64_t segment_count = 0;
+  // The bitrate of the representation being played.
+  int64_t current_bitrate = 0;
+  int64_t bitrate_switch_count = 0;
+  // The last reported buffer level in percent.
+  int32_t buffer_level = 100;
+  // Whether playback has started. The buffer is still being filled before.
+  bool playback_started = false;
+  // The number of times the buffer ran out after playback started.
+  int64_t rebuffer_count = 0;
+  // The max-bandwidth cap applied by the policy, or 0 if there is none.
+  int64_t max_bandwidth = 0;
+};
+
+// Decides the bitrate cap of a player from its telemetry. Called on the
+// player callback thread whenever the telemetry changes.
+class AbrPolicy {
+ public:
+  virtual ~AbrPolicy() = default;
+
+  // Returns the max-bandwidth to apply, or 0 to let the player choose freely.
+  virtual int64_t GetMaxBandwidth(const AbrTelemetry &telemetry) = 0;
+};
+
+// Pins the bitrate to at most a fixed value.
+class FixedBitratePolicy : public AbrPolicy {
+ public:
+  explicit FixedBitratePolicy(int64_t bitrate) : bitrate_(bitrate) {}
+
+  int64_t GetMaxBandwidth(const AbrTelemetry &telemetry) override {
+    return bitrate_;
+  }
+
+ private:
+  int64_t bitrate_;
+};
+
+// Caps the bitrate to a fraction of the measured throughput when the player
+// rebuffers or the buffer runs low during playback, and lifts the cap step by
+// step once the buffer stays full, so that congested networks stop stalling
+// while fast networks keep the best quality.
+class ThroughputAbrPolicy : public AbrPolicy {
+ public:
+  int64_t GetMaxBandwidth(const AbrTelemetry &telemetry) override;
+
+ private:
+  int64_t max_bandwidth_ = 0;
+  int64_t last_rebuffer_count_ = 0;
+  int64_t last_segment_count_ = 0;
+  int64_t healthy_segment_count_ = 0;
+};
+
+// Collects adaptive streaming telemetry and applies the bitrate cap decided by
+// an AbrPolicy. The methods may be called from any thread.
+class AbrController {
+ public:
+  // Applies |max_bandwidth| (0 to remove the cap) to the player.
+  using MaxBandwidthSetter = std::function<bool(int64_t max_bandwidth)>;
+
+  AbrController(std::unique_ptr<AbrPolicy> policy,
+                MaxBandwidthSetter max_bandwidth_setter);
+  AbrController(const AbrController &) = delete;
+  AbrController &operator=(const AbrController &) = delete;
+
+  // Creates a policy from the "abrPolicy" player option, which is either
+  // "throughput" or "fixed" (with the "abrBitrate" option). Returns nullptr if
+  // no policy is set, in which case only telemetry is collected.
+  static std::unique_ptr<AbrPolicy> CreatePolicy(
+      const flutter::EncodableMap *player_options);
+
+  void OnSegmentDownloaded(int64_t throughput);
+  void OnBitrateChanged(int64_t bitrate);
+  void OnBufferLevelChanged(int32_t buffer_level);
+  void OnPlaybackStarted();
+  // Ignored until playback has started.
+  void OnRebufferingStarted();
+
+  flutter::EncodableMap GetTelemetry() const;
+
+ private:
+  // Asks the policy for a new cap. Returns true if the cap should change, in
+  // which case ApplyMaxBandwidth() must be called after releasing |mutex_|.
+  // Must be called with |mutex_| held.
+  bool UpdatePolicy();
+  // Applies the latest cap decided by UpdatePolicy() to the player.
+  void ApplyMaxBandwidth();
+
+  mutable std::mutex mutex_;
+  // Serializes calls to |max_bandwidth_setter_| so that the latest decision
+  // is applied last. Acquired before |mutex_|.
+  std::mutex apply_mutex_;
+  AbrTelemetry telemetry_;
+  // The cap decided by the policy, which telemetry_.max_bandwidth follows
+  // once the player has accepted it.
+  int64_t target_max_bandwidth_ = 0;
+  std::unique_ptr<AbrPolicy> policy_;
+  MaxBandwidthSetter max_bandwidth_setter_;
+};
+
+}  // namespace video_player_avplay_tizen
+
+#endif  // FLUTTER_PLUGIN_ABR_CONTROLLER_H_
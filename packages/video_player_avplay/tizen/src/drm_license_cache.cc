@@ -0,0 +1,426 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "drm_license_cache.h"
+
+#include <app_common.h>
+#include <ckmc/ckmc-manager.h>
+#include <ckmc/ckmc-type.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <random>
+
+#include "log.h"
+
+namespace {
+
+constexpr char kLicenseCacheAesKey[] = "VideoPlayerAvplayLicenseCacheKey";
+constexpr char kLicenseCacheDirectory[] = "drm_license_cache/";
+constexpr char kLicenseCacheMagic[] = "AVPLC1";
+constexpr size_t kLicenseCacheMagicSize = sizeof(kLicenseCacheMagic) - 1;
+constexpr size_t kInitializationVectorSize = 12;
+constexpr size_t kMaxMemoryEntries = 32;
+
+uint32_t ReadUint32BigEndian(const uint8_t *data) {
+  return (static_cast<uint32_t>(data[0]) << 24) |
+         (static_cast<uint32_t>(data[1]) << 16) |
+         (static_cast<uint32_t>(data[2]) << 8) | static_cast<uint32_t>(data[3]);
+}
+
+// Returns the values of the <KID> elements of a PlayReady challenge, which
+// carry either the key ID as text (WRMHEADER 4.0) or as a VALUE attribute
+// (WRMHEADER 4.1 and later).
+std::vector<std::string> FindPlayReadyKeyIds(const std::string &challenge) {
+  std::vector<std::string> key_ids;
+  size_t pos = 0;
+  while ((pos = challenge.find("<KID", pos)) != std::string::npos) {
+    size_t tag_end = challenge.find('>', pos);
+    if (tag_end == std::string::npos) {
+      break;
+    }
+    std::string tag = challenge.substr(pos, tag_end - pos);
+    size_t value = tag.find("VALUE=\"");
+    if (value != std::string::npos) {
+      value += strlen("VALUE=\"");
+      size_t value_end = tag.find('"', value);
+      if (value_end != std::string::npos) {
+        key_ids.push_back(tag.substr(value, value_end - value));
+      }
+    } else if (tag.back() != '/') {
+      size_t text_end = challenge.find("</KID>", tag_end);
+      if (text_end != std::string::npos) {
+        key_ids.push_back(
+            challenge.substr(tag_end + 1, text_end - tag_end - 1));
+      }
+    }
+    pos = tag_end;
+  }
+  return key_ids;
+}
+
+// 64-bit FNV-1a, used to derive a file name from a cache key.
+std::string HashToHex(const std::string &value) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (unsigned char c : value) {
+    hash ^= c;
+    hash *= 0x100000001b3ULL;
+  }
+  char hex[17];
+  snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+  return hex;
+}
+
+std::vector<uint8_t> GenerateRandomVector(size_t size) {
+  static std::mt19937 mt(std::random_device{}());
+  static std::uniform_int_distribution<int> distrib(0, 255);
+
+  std::vector<uint8_t> vector;
+  for (size_t i = 0; i < size; i++) {
+    vector.emplace_back(static_cast<uint8_t>(distrib(mt)));
+  }
+  return vector;
+}
+
+}  // namespace
+
+std::string DrmLicenseCache::GetContentId(
+    const std::string &challenge, const std::vector<std::string> &pssh_list) {
+  std::vector<std::string> key_ids = FindPlayReadyKeyIds(challenge);
+  if (!key_ids.empty()) {
+    std::sort(key_ids.begin(), key_ids.end());
+    std::string content_id = "kid";
+    for (const std::string &key_id : key_ids) {
+      content_id += ":" + key_id;
+    }
+    return content_id;
+  }
+
+  // Widevine challenges embed the PSSH payload of the requested keys.
+  std::string content_id;
+  for (const std::string &pssh : pssh_list) {
+    if (!pssh.empty() && challenge.find(pssh) != std::string::npos) {
+      content_id += "pssh:" + pssh;
+    }
+  }
+  return content_id;
+}
+
+std::vector<std::string> DrmLicenseCache::ParsePsshPayloads(const void *data,
+                                                            size_t length) {
+  std::vector<std::string> payloads;
+  if (!data || length == 0) {
+    return payloads;
+  }
+
+  const uint8_t *bytes = static_cast<const uint8_t *>(data);
+  size_t offset = 0;
+  // size(4) + type(4) + version/flags(4) + system ID(16) + data size(4)
+  while (length - offset >= 32 && memcmp(bytes + offset + 4, "pssh", 4) == 0) {
+    size_t box_size = ReadUint32BigEndian(bytes + offset);
+    if (box_size < 32 || box_size > length - offset) {
+      break;
+    }
+    uint8_t version = bytes[offset + 8];
+    size_t pos = offset + 28;
+    if (version > 0) {
+      size_t key_id_count = ReadUint32BigEndian(bytes + pos);
+      pos += 4 + key_id_count * 16;
+    }
+    if (pos + 4 <= offset + box_size) {
+      size_t data_size = ReadUint32BigEndian(bytes + pos);
+      pos += 4;
+      if (data_size <= offset + box_size - pos) {
+        payloads.emplace_back(reinterpret_cast<const char *>(bytes + pos),
+                              data_size);
+      }
+    }
+    offset += box_size;
+  }
+
+  if (payloads.empty()) {
+    payloads.emplace_back(static_cast<const char *>(data), length);
+  }
+  return payloads;
+}
+
+std::string DrmLicenseCache::MakeKey(const std::string &license_server_url,
+                                     int drm_type,
+                                     const std::string &content_id) {
+  return license_server_url + "\n" + std::to_string(drm_type) + "\n" +
+         content_id;
+}
+
+bool DrmLicenseCache::Lookup(const std::string &key, std::string *response,
+                             bool search_disk) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  EvictExpiredEntries();
+
+  auto iter = entries_.find(key);
+  if (iter == entries_.end()) {
+    if (!search_disk) {
+      return false;
+    }
+    Entry entry;
+    if (!LoadFromDisk(key, &entry)) {
+      return false;
+    }
+    if (entry.expires_at <= std::chrono::system_clock::now()) {
+      RemoveFromDisk(key);
+      return false;
+    }
+    iter = entries_.emplace(key, std::move(entry)).first;
+  }
+  *response = iter->second.response;
+  return true;
+}
+
+void DrmLicenseCache::Store(const std::string &key, const std::string &response,
+                            int64_t max_age_seconds, bool persistent) {
+  if (max_age_seconds <= 0 || response.empty()) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  Entry entry;
+  entry.response = response;
+  entry.expires_at =
+      std::chrono::system_clock::now() + std::chrono::seconds(max_age_seconds);
+  if (persistent) {
+    SaveToDisk(key, entry);
+  }
+  entries_[key] = std::move(entry);
+
+  EvictExpiredEntries();
+  while (entries_.size() > kMaxMemoryEntries) {
+    auto oldest = std::min_element(
+        entries_.begin(), entries_.end(), [](const auto &a, const auto &b) {
+          return a.second.expires_at < b.second.expires_at;
+        });
+    entries_.erase(oldest);
+  }
+}
+
+void DrmLicenseCache::Remove(const std::string &key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.erase(key);
+  RemoveFromDisk(key);
+}
+
+void DrmLicenseCache::EvictExpiredEntries() {
+  auto now = std::chrono::system_clock::now();
+  for (auto iter = entries_.begin(); iter != entries_.end();) {
+    if (iter->second.expires_at <= now) {
+      iter = entries_.erase(iter);
+    } else {
+      iter++;
+    }
+  }
+}
+
+std::string DrmLicenseCache::GetCacheFilePath(const std::string &key,
+                                              bool create_directory) {
+  char *data_path = app_get_data_path();
+  if (!data_path) {
+    LOG_ERROR("[DrmLicenseCache] Fail to get data path.");
+    return std::string();
+  }
+  std::string directory = std::string(data_path) + kLicenseCacheDirectory;
+  free(data_path);
+
+  if (create_directory && access(directory.c_str(), F_OK) != 0 &&
+      mkdir(directory.c_str(), 0700) != 0) {
+    LOG_ERROR("[DrmLicenseCache] Fail to create %s.", directory.c_str());
+    return std::string();
+  }
+  return directory + HashToHex(key);
+}
+
+bool DrmLicenseCache::LoadFromDisk(const std::string &key, Entry *entry) {
+  std::string path = GetCacheFilePath(key, false);
+  if (path.empty() || access(path.c_str(), F_OK) != 0) {
+    return false;
+  }
+
+  FILE *file = fopen(path.c_str(), "rb");
+  if (!file) {
+    return false;
+  }
+  std::vector<uint8_t> encrypted;
+  uint8_t buffer[4096];
+  size_t read_size = 0;
+  while ((read_size = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    encrypted.insert(encrypted.end(), buffer, buffer + read_size);
+  }
+  fclose(file);
+
+  std::vector<uint8_t> plain = Decrypt(encrypted);
+  size_t header_size =
+      kLicenseCacheMagicSize + sizeof(int64_t) + sizeof(uint32_t);
+  if (plain.size() < header_size ||
+      memcmp(plain.data(), kLicenseCacheMagic, kLicenseCacheMagicSize) != 0) {
+    LOG_ERROR("[DrmLicenseCache] Invalid cache file, remove it.");
+    unlink(path.c_str());
+    return false;
+  }
+
+  const uint8_t *pos = plain.data() + kLicenseCacheMagicSize;
+  int64_t expires_at = 0;
+  memcpy(&expires_at, pos, sizeof(expires_at));
+  pos += sizeof(expires_at);
+  uint32_t key_size = 0;
+  memcpy(&key_size, pos, sizeof(key_size));
+  pos += sizeof(key_size);
+  if (key_size > plain.size() - header_size ||
+      key.compare(0, std::string::npos, reinterpret_cast<const char *>(pos),
+                  key_size) != 0) {
+    // Hash collision with another key.
+    return false;
+  }
+  pos += key_size;
+
+  entry->expires_at = std::chrono::system_clock::from_time_t(expires_at);
+  entry->response.assign(reinterpret_cast<const char *>(pos),
+                         plain.data() + plain.size() - pos);
+  return true;
+}
+
+void DrmLicenseCache::SaveToDisk(const std::string &key, const Entry &entry) {
+  std::string path = GetCacheFilePath(key, true);
+  if (path.empty()) {
+    return;
+  }
+
+  int64_t expires_at = std::chrono::system_clock::to_time_t(entry.expires_at);
+  uint32_t key_size = key.size();
+  std::vector<uint8_t> plain(kLicenseCacheMagic,
+                             kLicenseCacheMagic + kLicenseCacheMagicSize);
+  const uint8_t *expires_at_bytes =
+      reinterpret_cast<const uint8_t *>(&expires_at);
+  plain.insert(plain.end(), expires_at_bytes,
+               expires_at_bytes + sizeof(expires_at));
+  const uint8_t *key_size_bytes = reinterpret_cast<const uint8_t *>(&key_size);
+  plain.insert(plain.end(), key_size_bytes, key_size_bytes + sizeof(key_size));
+  plain.insert(plain.end(), key.begin(), key.end());
+  plain.insert(plain.end(), entry.response.begin(), entry.response.end());
+
+  std::vector<uint8_t> encrypted = Encrypt(plain);
+  if (encrypted.empty()) {
+    LOG_ERROR("[DrmLicenseCache] Fail to encrypt license, not persisted.");
+    return;
+  }
+
+  FILE *file = fopen(path.c_str(), "wb");
+  if (!file) {
+    LOG_ERROR("[DrmLicenseCache] Fail to open %s.", path.c_str());
+    return;
+  }
+  if (fwrite(encrypted.data(), 1, encrypted.size(), file) != encrypted.size()) {
+    LOG_ERROR("[DrmLicenseCache] Fail to write %s.", path.c_str());
+    fclose(file);
+    unlink(path.c_str());
+    return;
+  }
+  fclose(file);
+}
+
+void DrmLicenseCache::RemoveFromDisk(const std::string &key) {
+  std::string path = GetCacheFilePath(key, false);
+  if (!path.empty()) {
+    unlink(path.c_str());
+  }
+}
+
+bool DrmLicenseCache::CreateEncryptionKeyOnce() {
+  if (has_encryption_key_) {
+    return true;
+  }
+  ckmc_policy_s policy = {
+      .password = nullptr,
+      .extractable = false,
+  };
+  int ret = ckmc_create_key_aes(256, kLicenseCacheAesKey, policy);
+  if (ret != CKMC_ERROR_NONE && ret != CKMC_ERROR_DB_ALIAS_EXISTS) {
+    LOG_ERROR("[DrmLicenseCache] Fail to create encryption key: %d", ret);
+    return false;
+  }
+  has_encryption_key_ = true;
+  return true;
+}
+
+std::vector<uint8_t> DrmLicenseCache::Encrypt(
+    const std::vector<uint8_t> &plain) {
+  if (plain.empty() || !CreateEncryptionKeyOnce()) {
+    return {};
+  }
+
+  ckmc_raw_buffer_s plain_buffer;
+  plain_buffer.data = const_cast<uint8_t *>(plain.data());
+  plain_buffer.size = plain.size();
+
+  ckmc_param_list_h params = nullptr;
+  ckmc_generate_new_params(CKMC_ALGO_AES_GCM, &params);
+
+  std::vector<uint8_t> iv = GenerateRandomVector(kInitializationVectorSize);
+  ckmc_raw_buffer_s iv_buffer;
+  iv_buffer.data = iv.data();
+  iv_buffer.size = iv.size();
+  ckmc_param_list_set_buffer(params, CKMC_PARAM_ED_IV, &iv_buffer);
+
+  ckmc_raw_buffer_s *encrypted_buffer = nullptr;
+  int ret = ckmc_encrypt_data(params, kLicenseCacheAesKey, nullptr,
+                              plain_buffer, &encrypted_buffer);
+  ckmc_param_list_free(params);
+  if (ret != CKMC_ERROR_NONE || !encrypted_buffer) {
+    LOG_ERROR("[DrmLicenseCache] Fail to encrypt: %d", ret);
+    return {};
+  }
+
+  std::vector<uint8_t> encrypted(iv);
+  encrypted.insert(encrypted.end(), encrypted_buffer->data,
+                   encrypted_buffer->data + encrypted_buffer->size);
+  ckmc_buffer_free(encrypted_buffer);
+  return encrypted;
+}
+
+std::vector<uint8_t> DrmLicenseCache::Decrypt(
+    const std::vector<uint8_t> &encrypted) {
+  if (encrypted.size() <= kInitializationVectorSize ||
+      !CreateEncryptionKeyOnce()) {
+    return {};
+  }
+
+  std::vector<uint8_t> iv(encrypted.begin(),
+                          encrypted.begin() + kInitializationVectorSize);
+  ckmc_raw_buffer_s iv_buffer;
+  iv_buffer.data = iv.data();
+  iv_buffer.size = iv.size();
+
+  ckmc_param_list_h params = nullptr;
+  ckmc_generate_new_params(CKMC_ALGO_AES_GCM, &params);
+  ckmc_param_list_set_buffer(params, CKMC_PARAM_ED_IV, &iv_buffer);
+
+  std::vector<uint8_t> encrypted_value(
+      encrypted.begin() + kInitializationVectorSize, encrypted.end());
+  ckmc_raw_buffer_s encrypted_buffer;
+  encrypted_buffer.data = encrypted_value.data();
+  encrypted_buffer.size = encrypted_value.size();
+
+  ckmc_raw_buffer_s *decrypted_buffer = nullptr;
+  int ret = ckmc_decrypt_data(params, kLicenseCacheAesKey, nullptr,
+                              encrypted_buffer, &decrypted_buffer);
+  ckmc_param_list_free(params);
+  if (ret != CKMC_ERROR_NONE || !decrypted_buffer) {
+    LOG_ERROR("[DrmLicenseCache] Fail to decrypt: %d", ret);
+    return {};
+  }
+
+  std::vector<uint8_t> decrypted(
+      decrypted_buffer->data, decrypted_buffer->data + decrypted_buffer->size);
+  ckmc_buffer_free(decrypted_buffer);
+  return decrypted;
+}
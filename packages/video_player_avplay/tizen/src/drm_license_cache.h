@@ -0,0 +1,74 @@
+// Copyright 2025 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_DRM_LICENSE_CACHE_H_
+#define FLUTTER_PLUGIN_DRM_LICENSE_CACHE_H_
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Process-wide cache of DRM license responses.
+//
+// Entries are keyed by the license server and the identity of the content
+// keys (key IDs or PSSH payload) rather than by the challenge itself, because
+// challenges carry a nonce and differ on every request. Persistent entries are
+// encrypted with a key held by the key manager before being written to the
+// app data directory.
+class DrmLicenseCache {
+ public:
+  static DrmLicenseCache &GetInstance() {
+    static DrmLicenseCache instance;
+    return instance;
+  }
+  DrmLicenseCache(const DrmLicenseCache &) = delete;
+  DrmLicenseCache &operator=(const DrmLicenseCache &) = delete;
+
+  // Returns the identity of the keys requested by |challenge|, or an empty
+  // string if the keys cannot be identified (the response is not cached).
+  static std::string GetContentId(const std::string &challenge,
+                                  const std::vector<std::string> &pssh_list);
+
+  // Returns the payloads of the PSSH boxes contained in |data|. If |data| is
+  // not a PSSH box, it is returned as is.
+  static std::vector<std::string> ParsePsshPayloads(const void *data,
+                                                    size_t length);
+
+  static std::string MakeKey(const std::string &license_server_url,
+                             int drm_type, const std::string &content_id);
+
+  // Returns the cached response of |key|. Responses stored persistently by
+  // earlier app sessions are searched for only if |search_disk| is true.
+  bool Lookup(const std::string &key, std::string *response, bool search_disk);
+  void Store(const std::string &key, const std::string &response,
+             int64_t max_age_seconds, bool persistent);
+  void Remove(const std::string &key);
+
+ private:
+  struct Entry {
+    std::string response;
+    std::chrono::system_clock::time_point expires_at;
+  };
+
+  DrmLicenseCache() = default;
+  ~DrmLicenseCache() = default;
+
+  void EvictExpiredEntries();
+  std::string GetCacheFilePath(const std::string &key, bool create_directory);
+  bool LoadFromDisk(const std::string &key, Entry *entry);
+  void SaveToDisk(const std::string &key, const Entry &entry);
+  void RemoveFromDisk(const std::string &key);
+  bool CreateEncryptionKeyOnce();
+  std::vector<uint8_t> Encrypt(const std::vector<uint8_t> &plain);
+  std::vector<uint8_t> Decrypt(const std::vector<uint8_t> &encrypted);
+
+  std::mutex mutex_;
+  std::map<std::string, Entry> entries_;
+  bool has_encryption_key_ = false;
+};
+
+#endif  // FLUTTER_PLUGIN_DRM_LICENSE_CACHE_H_
@@ -10,6 +10,13 @@
 #include <string.h>
 #include <strings.h>
 
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "log.h"
 
 #define DEFAULT_USER_AGENT_PLAYREADY "User-Agent: PlayReadyClient"
@@ -38,6 +45,14 @@
     }                              \
   }
 
+// Maximum number of idle connections kept per license server.
+#define MAX_IDLE_HANDLES_PER_SERVER (4)
+// Maximum number of live connections kept in the shared connection cache.
+// libcurl closes connections beyond this limit (5 by default) as soon as they
+// are released, which defeats reuse when several licenses are requested
+// concurrently.
+#define MAX_CACHED_CONNECTIONS (16L)
+
 #define MAX_POPUP_MESSAGE_LENGTH (1024)
 #define ERROR_TITLE_LICENSE_FETCHING_FAILURE "Fetching License Failed"
 
@@ -51,6 +66,7 @@ struct SDynamicBuf {
 
 struct SHttpSession {
   void* curl_handle;
+  char* server_key;          // license server the connection belongs to
   unsigned char* post_data;  // request body
   size_t post_data_len;      // length of request body
   DrmLicenseHelper::DrmType type;
@@ -60,6 +76,156 @@ struct SHttpSession {
   long res_code;
 };
 
+// Keeps easy handles that finished a transaction so that the next request to
+// the same license server reuses the open connection instead of paying for
+// DNS, TCP and TLS handshakes again. All handles share the DNS cache, the TLS
+// session cache and, when supported by libcurl, the connection cache.
+class LicenseConnectionPool {
+ public:
+  static LicenseConnectionPool& GetInstance() {
+    static LicenseConnectionPool instance;
+    return instance;
+  }
+
+  LicenseConnectionPool(const LicenseConnectionPool&) = delete;
+  LicenseConnectionPool& operator=(const LicenseConnectionPool&) = delete;
+
+  CURL* Acquire(const std::string& server_key) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      EvictExpiredHandles();
+      auto iter = idle_handles_.find(server_key);
+      if (iter != idle_handles_.end() && !iter->second.empty()) {
+        CURL* handle = iter->second.back().handle;
+        iter->second.pop_back();
+        LOG_DEBUG("[DrmLicenseHelper] Reuse connection to %s",
+                  server_key.c_str());
+        return handle;
+      }
+    }
+
+    CURL* handle = curl_easy_init();
+    if (handle && share_) {
+      curl_easy_setopt(handle, CURLOPT_SHARE, share_);
+    }
+    return handle;
+  }
+
+  void Release(const std::string& server_key, CURL* handle) {
+    if (!handle) {
+      return;
+    }
+    // Drop references to per-transaction data (headers, callbacks) while
+    // keeping the live connection and the shared caches of the handle.
+    curl_easy_reset(handle);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<IdleHandle>& handles = idle_handles_[server_key];
+    if (idle_timeout_ <= 0 || handles.size() >= MAX_IDLE_HANDLES_PER_SERVER) {
+      curl_easy_cleanup(handle);
+      return;
+    }
+    handles.push_back({handle, std::chrono::steady_clock::now()});
+  }
+
+  void SetIdleTimeout(long seconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    idle_timeout_ = seconds;
+    EvictExpiredHandles();
+  }
+
+  long GetIdleTimeout() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return idle_timeout_;
+  }
+
+ private:
+  struct IdleHandle {
+    CURL* handle;
+    std::chrono::steady_clock::time_point released_at;
+  };
+
+  LicenseConnectionPool() {
+    share_ = curl_share_init();
+    if (!share_) {
+      LOG_ERROR("[DrmLicenseHelper] Fail to create curl share handle.");
+      return;
+    }
+    curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, LockShare);
+    curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, UnlockShare);
+    curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+  }
+
+  ~LicenseConnectionPool() {
+    for (auto& [server_key, handles] : idle_handles_) {
+      for (IdleHandle& idle_handle : handles) {
+        curl_easy_cleanup(idle_handle.handle);
+      }
+    }
+    idle_handles_.clear();
+    if (share_) {
+      curl_share_cleanup(share_);
+      share_ = nullptr;
+    }
+  }
+
+  // Must be called with mutex_ held.
+  void EvictExpiredHandles() {
+    auto now = std::chrono::steady_clock::now();
+    for (auto iter = idle_handles_.begin(); iter != idle_handles_.end();) {
+      std::vector<IdleHandle>& handles = iter->second;
+      for (auto handle = handles.begin(); handle != handles.end();) {
+        if (idle_timeout_ <= 0 ||
+            now - handle->released_at >= std::chrono::seconds(idle_timeout_)) {
+          curl_easy_cleanup(handle->handle);
+          handle = handles.erase(handle);
+        } else {
+          handle++;
+        }
+      }
+      if (handles.empty()) {
+        iter = idle_handles_.erase(iter);
+      } else {
+        iter++;
+      }
+    }
+  }
+
+  static void LockShare(CURL* handle, curl_lock_data data,
+                        curl_lock_access access, void* user_data) {
+    auto* self = static_cast<LicenseConnectionPool*>(user_data);
+    self->share_mutexes_[data % CURL_LOCK_DATA_LAST].lock();
+  }
+
+  static void UnlockShare(CURL* handle, curl_lock_data data, void* user_data) {
+    auto* self = static_cast<LicenseConnectionPool*>(user_data);
+    self->share_mutexes_[data % CURL_LOCK_DATA_LAST].unlock();
+  }
+
+  std::mutex mutex_;
+  std::map<std::string, std::vector<IdleHandle>> idle_handles_;
+  long idle_timeout_ = DrmLicenseHelper::kDefaultConnectionIdleTimeout;
+  CURLSH* share_ = nullptr;
+  std::mutex share_mutexes_[CURL_LOCK_DATA_LAST];
+};
+
+// Returns "scheme://host[:port]" of the given URL, which identifies the
+// connections that can be reused for it.
+std::string GetServerKey(const char* url) {
+  if (!url) {
+    return std::string();
+  }
+  std::string url_string(url);
+  size_t host_start = url_string.find("://");
+  host_start = (host_start == std::string::npos) ? 0 : host_start + 3;
+  return url_string.substr(0, url_string.find_first_of("/?#", host_start));
+}
+
 // Internal Static Functions
 static size_t ReceiveHeader(void* ptr, size_t size, size_t nmemb, void* stream);
 static size_t ReceiveBody(void* ptr, size_t size, size_t nmemb, void* stream);
@@ -77,7 +243,7 @@ static struct curl_slist* SetHttpHeader(CURL* http_curl,
                                         const char* http_cookie,
                                         const char* http_header,
                                         const char* http_user_agent);
-static SHttpSession* HttpOpen(void);
+static SHttpSession* HttpOpen(const char* http_url);
 static int CbCurlProgress(void* ptr, double total_to_download,
                           double now_downloaded, double total_to_upload,
                           double now_uploaded);
@@ -86,7 +252,7 @@ static DRM_RESULT HttpStartTransaction(
     unsigned post_data_len, DrmLicenseHelper::DrmType type,
     const char* http_cookie, const char* http_soap_header,
     const char* http_header, const char* http_user_agent,
-    bool* http_cancel_request);
+    std::atomic<bool>* http_cancel_request);
 static void HttpClose(SHttpSession* http_session);
 
 bool AppendData(SDynamicBuf* buffer, const void* append_data,
@@ -381,15 +547,17 @@ struct curl_slist* SetHttpHeader(CURL* http_curl,
   return headers;
 }
 
-static SHttpSession* HttpOpen(void) {
+static SHttpSession* HttpOpen(const char* http_url) {
   SHttpSession* http_session = nullptr;
 
-  CURL* http_curl = curl_easy_init();
+  std::string server_key = GetServerKey(http_url);
+  CURL* http_curl = LicenseConnectionPool::GetInstance().Acquire(server_key);
   if (http_curl) {
     http_session = static_cast<SHttpSession*>(malloc(sizeof(SHttpSession)));
     if (http_session) {
       memset(http_session, 0, sizeof(SHttpSession));
       http_session->curl_handle = http_curl;
+      http_session->server_key = strdup(server_key.c_str());
       return http_session;
     }
     curl_easy_cleanup(http_curl);
@@ -401,13 +569,13 @@ static SHttpSession* HttpOpen(void) {
 
 int CbCurlProgress(void* ptr, double total_to_download, double now_downloaded,
                    double total_to_upload, double now_uploaded) {
-  bool* http_cancel_request = static_cast<bool*>(ptr);
+  auto* http_cancel_request = static_cast<std::atomic<bool>*>(ptr);
 
   if (http_cancel_request) {
-    LOG_INFO("[DrmLicenseHelper] http_cancel_request: (%d)",
-             *http_cancel_request);
+    bool canceled = http_cancel_request->load();
+    LOG_INFO("[DrmLicenseHelper] http_cancel_request: (%d)", canceled);
 
-    if (*http_cancel_request) {
+    if (canceled) {
       LOG_INFO("[DrmLicenseHelper] curl works canceled.");
       return 1;
     }
@@ -421,7 +589,7 @@ DRM_RESULT HttpStartTransaction(
     unsigned post_data_len, DrmLicenseHelper::DrmType type,
     const char* http_cookie, const char* http_soap_header,
     const char* http_header, const char* http_user_agent,
-    bool* http_cancel_request) {
+    std::atomic<bool>* http_cancel_request) {
   CURLcode res = CURLE_OK;
   struct curl_slist* headers = nullptr;
   CURL* http_curl = http_session->curl_handle;
@@ -448,8 +616,21 @@ DRM_RESULT HttpStartTransaction(
 
   curl_easy_setopt(http_curl, CURLOPT_VERBOSE, 0L);
 
-  // Check
-  curl_easy_setopt(http_curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_0);
+  // HTTP/1.1 keeps the connection alive so that the next license request
+  // (e.g. key rotation in live streams) can skip the handshakes.
+  curl_easy_setopt(http_curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1);
+  long idle_timeout = LicenseConnectionPool::GetInstance().GetIdleTimeout();
+  if (idle_timeout > 0) {
+    curl_easy_setopt(http_curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(http_curl, CURLOPT_TCP_KEEPIDLE, idle_timeout);
+    curl_easy_setopt(http_curl, CURLOPT_MAXCONNECTS, MAX_CACHED_CONNECTIONS);
+#if LIBCURL_VERSION_NUM >= 0x074100
+    curl_easy_setopt(http_curl, CURLOPT_MAXAGE_CONN, idle_timeout);
+#endif
+  } else {
+    curl_easy_setopt(http_curl, CURLOPT_FORBID_REUSE, 1L);
+    curl_easy_setopt(http_curl, CURLOPT_FRESH_CONNECT, 1L);
+  }
 
   int soap_flag = 0;
 
@@ -621,7 +802,13 @@ void HttpClose(SHttpSession* http_session) {
   }
 
   if (http_session->curl_handle != nullptr) {
-    curl_easy_cleanup(http_session->curl_handle);
+    LicenseConnectionPool::GetInstance().Release(
+        http_session->server_key ? http_session->server_key : "",
+        http_session->curl_handle);
+  }
+
+  if (http_session->server_key) {
+    free(http_session->server_key);
   }
 
   if (http_session->post_data) {
@@ -709,7 +896,7 @@ DRM_RESULT DrmLicenseHelper::DoTransactionTZ(
 
   // Redirection 3 times..
   for (int i = 0; i < 3; i++) {
-    if (!(http_session = HttpOpen())) {
+    if (!(http_session = HttpOpen(http_url))) {
       LOG_ERROR("[DrmLicenseHelper] Failed to open HTTP session.");
       break;
     }
@@ -717,7 +904,7 @@ DRM_RESULT DrmLicenseHelper::DoTransactionTZ(
     char* soap_header = nullptr;
     char* http_header = nullptr;
     char* user_agent = nullptr;
-    bool* cancel_request = nullptr;
+    std::atomic<bool>* cancel_request = nullptr;
 
     if (http_ext_ctx != nullptr) {
       if (http_ext_ctx->http_soap_header) {
@@ -802,3 +989,8 @@ DRM_RESULT DrmLicenseHelper::DoTransactionTZ(
 
   return drm_result;
 }
+
+void DrmLicenseHelper::SetConnectionIdleTimeout(long seconds) {
+  LOG_INFO("[DrmLicenseHelper] Connection idle timeout: %ld", seconds);
+  LicenseConnectionPool::GetInstance().SetIdleTimeout(seconds);
+}
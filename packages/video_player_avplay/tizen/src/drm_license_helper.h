@@ -5,6 +5,8 @@
 #ifndef FLUTTER_PLUGIN_DRM_LICENSE_HELPER_H_
 #define FLUTTER_PLUGIN_DRM_LICENSE_HELPER_H_
 
+#include <atomic>
+
 typedef long DRM_RESULT;
 
 const DRM_RESULT DRM_SUCCESS = 0x00000000L;
@@ -32,9 +34,12 @@ class DrmLicenseHelper {
     char* http_soap_header = nullptr;
     char* http_header = nullptr;
     char* http_user_agent = nullptr;
-    bool cancel_request = false;
+    std::atomic<bool> cancel_request{false};
   };
 
+  // How long an idle connection to a license server is kept for reuse.
+  static constexpr long kDefaultConnectionIdleTimeout = 30;  // seconds
+
   static DRM_RESULT DoTransactionTZ(const char* http_server_url,
                                     const void* challenge,
                                     unsigned long challenge_len,
@@ -42,6 +47,10 @@ class DrmLicenseHelper {
                                     unsigned long* response_len, DrmType type,
                                     const char* http_cookie,
                                     SExtensionCtxTZ* http_ext_ctx);
+
+  // Sets the idle timeout of pooled license server connections in seconds.
+  // A value of 0 or less disables connection reuse.
+  static void SetConnectionIdleTimeout(long seconds);
 };
 
 #endif  // FLUTTER_PLUGIN_DRM_LICENSE_HELPER_H_
@@ -7,10 +7,23 @@
 #include <flutter/method_result_functions.h>
 #include <flutter/standard_method_codec.h>
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "drm_license_cache.h"
 #include "drm_license_helper.h"
 #include "drm_manager_proxy.h"
 #include "log.h"
 
+// The maximum number of license transactions run at the same time. Multi-key
+// content (e.g. separate audio, video and HD keys) requests several licenses
+// at once.
+constexpr size_t kMaxConcurrentLicenseRequests = 4;
+
+// How long a license worker waits for another request before it exits.
+constexpr int kLicenseWorkerIdleTimeoutSeconds = 10;
+
 static std::string GetDrmSubType(int drm_type) {
   switch (drm_type) {
     case DrmManager::DRM_TYPE_PLAYREADAY:
@@ -21,21 +34,35 @@ static std::string GetDrmSubType(int drm_type) {
   }
 }
 
-DrmManager::DrmManager() : drm_type_(DM_TYPE_NONE) {
+DrmManager::DrmManager()
+    : drm_type_(DM_TYPE_NONE),
+      license_workers_(std::make_shared<LicenseWorkerState>()) {
+  license_workers_->owner = this;
   license_request_pipe_ = ecore_pipe_add(
       [](void *data, void *buffer, unsigned int nbyte) -> void {
         auto *self = static_cast<DrmManager *>(data);
         self->ExecuteRequest();
       },
       this);
+  license_response_pipe_ = ecore_pipe_add(
+      [](void *data, void *buffer, unsigned int nbyte) -> void {
+        auto *self = static_cast<DrmManager *>(data);
+        self->InstallCompletedLicenses();
+      },
+      this);
 }
 
 DrmManager::~DrmManager() {
+  StopLicenseWorkers();
   ReleaseDrmSession();
   if (license_request_pipe_) {
     ecore_pipe_del(license_request_pipe_);
     license_request_pipe_ = nullptr;
   }
+  if (license_response_pipe_) {
+    ecore_pipe_del(license_response_pipe_);
+    license_response_pipe_ = nullptr;
+  }
 }
 
 bool DrmManager::CreateDrmSession(int drm_type, bool local_mode) {
@@ -54,6 +81,7 @@ bool DrmManager::CreateDrmSession(int drm_type, bool local_mode) {
   }
   LOG_INFO("[DrmManager] Drm session is created, drm_session: %p",
            drm_session_);
+  MarkStartupStage(StartupTimeline::kDrmSessionCreated);
 
   SetDataParam_t configure_param = {};
   configure_param.param1 = reinterpret_cast<void *>(OnDrmManagerError);
@@ -87,6 +115,7 @@ bool DrmManager::SetChallenge(const std::string &media_url,
 }
 
 void DrmManager::StopDrmSession() {
+  CancelLicenseRequests();
   if (drm_session_ == nullptr) {
     LOG_ERROR("[DrmManager] Already released.");
     return;
@@ -148,6 +177,7 @@ int DrmManager::UpdatePsshData(const void *data, int length) {
     LOG_ERROR("[DrmManager] Invalid drm session.");
     return DM_ERROR_INVALID_SESSION;
   }
+  AddPsshData(data, length);
 
   SetDataParam_t pssh_data_param = {};
   pssh_data_param.param1 = const_cast<void *>(data);
@@ -172,6 +202,7 @@ bool DrmManager::SecurityInitCompleteCB(int *drm_handle, unsigned int len,
     security_param.param1 = user_data;
   }
   security_param.param2 = drm_session_;
+  AddPsshData(pssh_data, len);
 
   return DrmManagerProxy::GetInstance().DMGRSecurityInitCompleteCB(
       drm_handle, len, pssh_data, &security_param);
@@ -237,34 +268,55 @@ void DrmManager::OnDrmManagerError(long error_code, char *error_message,
 
 bool DrmManager::ProcessLicense(DataForLicenseProcess &data) {
   LOG_INFO("[DrmManager] Start process license.");
+  MarkStartupStage(StartupTimeline::kLicenseRequested);
+
+  auto license = std::make_shared<PendingLicense>();
+  license->session_id = data.session_id;
+  license->message = data.message;
+  license->cache_key = GetLicenseCacheKey(data.message);
+
+  // Only sessions that persist licenses search the disk, so that a cache miss
+  // does not block the main thread on file system access.
+  std::string response;
+  if (!license->cache_key.empty() &&
+      DrmLicenseCache::GetInstance().Lookup(license->cache_key, &response,
+                                            persist_license_cache_)) {
+    LOG_INFO("[DrmManager] Found cached license, length: %zu",
+             response.size());
+    license->from_cache = true;
+    CompleteLicense(license, true, std::move(response));
+    pending_licenses_.push_back(license);
+    return true;
+  }
+
+  pending_licenses_.push_back(license);
+  if (!RequestLicense(license)) {
+    pending_licenses_.pop_back();
+    return false;
+  }
+  return true;
+}
 
+bool DrmManager::RequestLicense(
+    const std::shared_ptr<PendingLicense> &license) {
   if (!license_server_url_.empty()) {
-    // Get license via the license server.
-    unsigned char *response_data = nullptr;
-    unsigned long response_len = 0;
-    DRM_RESULT ret = DrmLicenseHelper::DoTransactionTZ(
-        license_server_url_.c_str(), data.message.c_str(), data.message.size(),
-        &response_data, &response_len,
-        static_cast<DrmLicenseHelper::DrmType>(drm_type_), nullptr, nullptr);
-    if (DRM_SUCCESS != ret || nullptr == response_data || 0 == response_len) {
-      LOG_ERROR("[DrmManager] Fail to get respone by license server url.");
-      SendInstallKeyError();
-      return false;
-    }
-    LOG_INFO("[DrmManager] Response length : %lu", response_len);
-    if (!InstallKey(const_cast<void *>(reinterpret_cast<const void *>(
-                        data.session_id.c_str())),
-                    static_cast<void *>(response_data),
-                    reinterpret_cast<void *>(response_len))) {
-      SendInstallKeyError();
+    // Get license via the license server on a worker thread.
+    {
+      std::lock_guard<std::mutex> lock(license_workers_->mutex);
+      license_workers_->license_server_url = license_server_url_;
+      license_workers_->drm_type =
+          static_cast<DrmLicenseHelper::DrmType>(drm_type_);
+      license_workers_->transaction_queue.push(license);
     }
-    free(response_data);
+    StartLicenseWorkers();
+    license_workers_->cv.notify_one();
+    return true;
   } else if (request_license_channel_) {
     // Get license via the Dart callback.
-    RequestLicense(data.session_id, data.message);
-  } else {
-    LOG_ERROR("[DrmManager] No way to request license.");
+    RequestLicenseFromDart(license);
+    return true;
   }
+  LOG_ERROR("[DrmManager] No way to request license.");
   return false;
 }
 
@@ -283,6 +335,7 @@ bool DrmManager::InstallKey(void *session_id, void *response_data,
               get_error_message(ret));
     return false;
   }
+  MarkStartupStage(StartupTimeline::kLicenseInstalled);
   return true;
 }
 
@@ -300,40 +353,41 @@ void DrmManager::SendInstallKeyError() {
   }
 }
 
-void DrmManager::RequestLicense(std::string &session_id, std::string &message) {
+void DrmManager::RequestLicenseFromDart(
+    const std::shared_ptr<PendingLicense> &license) {
   LOG_INFO("[DrmManager] Start request license.");
 
-  if (request_license_channel_ == nullptr) {
-    LOG_ERROR("[DrmManager] request license channel is null.");
-    return;
-  }
-
-  std::vector<uint8_t> message_vec(message.begin(), message.end());
+  std::vector<uint8_t> message_vec(license->message.begin(),
+                                   license->message.end());
   flutter::EncodableMap args_map = {
       {flutter::EncodableValue("message"),
        flutter::EncodableValue(message_vec)},
   };
   auto result_handler =
       std::make_unique<flutter::MethodResultFunctions<flutter::EncodableValue>>(
-
-          [session_id, this](const flutter::EncodableValue *success_value) {
-            std::vector<uint8_t> response;
-            if (std::holds_alternative<std::vector<uint8_t>>(*success_value)) {
-              response = std::get<std::vector<uint8_t>>(*success_value);
+          [license, this](const flutter::EncodableValue *success_value) {
+            if (success_value &&
+                std::holds_alternative<std::vector<uint8_t>>(*success_value)) {
+              const auto &response =
+                  std::get<std::vector<uint8_t>>(*success_value);
+              LOG_INFO("[DrmManager] Response length : %d", response.size());
+              CompleteLicense(license, true,
+                              std::string(response.begin(), response.end()));
             } else {
               LOG_ERROR("[DrmManager] Fail to get response.");
-              SendInstallKeyError();
-              return;
-            }
-            LOG_INFO("[DrmManager] Response length : %d", response.size());
-            if (!InstallKey(const_cast<void *>(reinterpret_cast<const void *>(
-                                session_id.c_str())),
-                            reinterpret_cast<void *>(response.data()),
-                            reinterpret_cast<void *>(response.size()))) {
-              SendInstallKeyError();
+              CompleteLicense(license, false, std::string());
             }
+            InstallCompletedLicenses();
           },
-          nullptr, nullptr);
+          [license, this](const std::string &error_code,
+                          const std::string &error_message,
+                          const flutter::EncodableValue *error_details) {
+            LOG_ERROR("[DrmManager] Fail to request license: %s",
+                      error_message.c_str());
+            CompleteLicense(license, false, std::string());
+            InstallCompletedLicenses();
+          },
+          nullptr);
   request_license_channel_->InvokeMethod(
       "requestLicense",
       std::make_unique<flutter::EncodableValue>(
@@ -341,6 +395,160 @@ void DrmManager::RequestLicense(std::string &session_id, std::string &message) {
       std::move(result_handler));
 }
 
+void DrmManager::CompleteLicense(const std::shared_ptr<PendingLicense> &license,
+                                 bool succeeded, std::string response) {
+  if (succeeded) {
+    MarkStartupStage(StartupTimeline::kLicenseReceived);
+  }
+  std::lock_guard<std::mutex> lock(license_workers_->mutex);
+  license->response = std::move(response);
+  license->succeeded = succeeded;
+  license->completed = true;
+}
+
+void DrmManager::InstallCompletedLicenses() {
+  // Licenses of different sessions are installed as soon as they arrive, but
+  // licenses of the same session are installed in the order requested.
+  auto it = pending_licenses_.begin();
+  while (it != pending_licenses_.end()) {
+    std::shared_ptr<PendingLicense> license = *it;
+    bool waiting_for_earlier = std::any_of(
+        pending_licenses_.begin(), it,
+        [&license](const std::shared_ptr<PendingLicense> &earlier) {
+          return earlier->session_id == license->session_id;
+        });
+    bool completed = false;
+    bool succeeded = false;
+    {
+      std::lock_guard<std::mutex> lock(license_workers_->mutex);
+      completed = license->completed;
+      succeeded = license->succeeded;
+    }
+    if (waiting_for_earlier || !completed) {
+      ++it;
+      continue;
+    }
+
+    if (succeeded &&
+        InstallKey(const_cast<void *>(reinterpret_cast<const void *>(
+                       license->session_id.c_str())),
+                   const_cast<void *>(reinterpret_cast<const void *>(
+                       license->response.data())),
+                   reinterpret_cast<void *>(license->response.size()))) {
+      if (!license->from_cache) {
+        StoreLicense(license->cache_key, license->response);
+      }
+    } else if (license->from_cache) {
+      // The license may have been revoked or expired earlier than expected.
+      LOG_ERROR("[DrmManager] Cached license rejected, request a new one.");
+      DrmLicenseCache::GetInstance().Remove(license->cache_key);
+      {
+        std::lock_guard<std::mutex> lock(license_workers_->mutex);
+        license->from_cache = false;
+        license->completed = false;
+        license->response.clear();
+      }
+      if (RequestLicense(license)) {
+        ++it;
+        continue;
+      }
+    } else {
+      SendInstallKeyError();
+    }
+    it = pending_licenses_.erase(it);
+  }
+}
+
+void DrmManager::CancelLicenseRequests() {
+  std::lock_guard<std::mutex> lock(license_workers_->mutex);
+  std::queue<std::shared_ptr<PendingLicense>>().swap(
+      license_workers_->transaction_queue);
+  for (const std::shared_ptr<PendingLicense> &license : pending_licenses_) {
+    license->http_ext_ctx.cancel_request = true;
+  }
+  pending_licenses_.clear();
+}
+
+void DrmManager::StartLicenseWorkers() {
+  std::lock_guard<std::mutex> lock(license_workers_->mutex);
+  if (license_workers_->worker_count >= kMaxConcurrentLicenseRequests) {
+    return;
+  }
+  if (license_workers_->idle_worker_count <
+      license_workers_->transaction_queue.size()) {
+    std::thread(&DrmManager::RunLicenseWorker, license_workers_).detach();
+    license_workers_->worker_count++;
+  }
+}
+
+void DrmManager::StopLicenseWorkers() {
+  CancelLicenseRequests();
+  {
+    std::lock_guard<std::mutex> lock(license_workers_->mutex);
+    license_workers_->stopped = true;
+  }
+  license_workers_->cv.notify_all();
+  // Cancelled transactions may take a while to return. Only a worker that is
+  // reporting a result is waited for.
+  std::lock_guard<std::mutex> lock(license_workers_->owner_mutex);
+  license_workers_->owner = nullptr;
+}
+
+void DrmManager::RunLicenseWorker(std::shared_ptr<LicenseWorkerState> state) {
+  while (true) {
+    std::shared_ptr<PendingLicense> license;
+    std::string license_server_url;
+    DrmLicenseHelper::DrmType drm_type;
+    {
+      std::unique_lock<std::mutex> lock(state->mutex);
+      state->idle_worker_count++;
+      bool has_work = state->cv.wait_for(
+          lock, std::chrono::seconds(kLicenseWorkerIdleTimeoutSeconds),
+          [&state] {
+            return state->stopped || !state->transaction_queue.empty();
+          });
+      state->idle_worker_count--;
+      if (state->stopped) {
+        return;
+      }
+      if (!has_work) {
+        // Licenses are mostly requested in bursts at start-up and on key
+        // rotation, so idle workers are not kept around.
+        state->worker_count--;
+        return;
+      }
+      license = state->transaction_queue.front();
+      state->transaction_queue.pop();
+      license_server_url = state->license_server_url;
+      drm_type = state->drm_type;
+    }
+
+    unsigned char *response_data = nullptr;
+    unsigned long response_len = 0;
+    DRM_RESULT ret = DrmLicenseHelper::DoTransactionTZ(
+        license_server_url.c_str(), license->message.c_str(),
+        license->message.size(), &response_data, &response_len, drm_type,
+        nullptr, &license->http_ext_ctx);
+    bool succeeded = false;
+    std::string response;
+    if (DRM_SUCCESS != ret || nullptr == response_data || 0 == response_len) {
+      LOG_ERROR("[DrmManager] Fail to get respone by license server url.");
+    } else {
+      LOG_INFO("[DrmManager] Response length : %lu", response_len);
+      succeeded = true;
+      response.assign(reinterpret_cast<char *>(response_data), response_len);
+    }
+    free(response_data);
+
+    std::lock_guard<std::mutex> lock(state->owner_mutex);
+    if (!state->owner) {
+      return;
+    }
+    state->owner->CompleteLicense(license, succeeded, std::move(response));
+    ecore_pipe_write(state->owner->license_response_pipe_, nullptr, 0);
+  }
+}
+
 void DrmManager::PushLicenseRequestData(DataForLicenseProcess &data) {
   std::lock_guard<std::mutex> lock(queue_mutex_);
   license_request_queue_.push(data);
@@ -348,10 +556,91 @@ void DrmManager::PushLicenseRequestData(DataForLicenseProcess &data) {
 }
 
 void DrmManager::ExecuteRequest() {
-  std::lock_guard<std::mutex> lock(queue_mutex_);
-  while (!license_request_queue_.empty()) {
-    DataForLicenseProcess data = license_request_queue_.front();
-    ProcessLicense(data);
-    license_request_queue_.pop();
+  std::queue<DataForLicenseProcess> requests;
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    std::swap(requests, license_request_queue_);
+  }
+  while (!requests.empty()) {
+    ProcessLicense(requests.front());
+    requests.pop();
+  }
+  InstallCompletedLicenses();
+}
+
+void DrmManager::SetLicenseCache(int64_t max_age_seconds, bool persistent) {
+  LOG_INFO("[DrmManager] License cache max age: %lld, persistent: %d",
+           max_age_seconds, persistent);
+  license_cache_max_age_ = max_age_seconds;
+  persist_license_cache_ = persistent;
+}
+
+bool DrmManager::PrefetchLicense(const std::string &media_url, int drm_type,
+                                 const std::string &license_server_url,
+                                 int64_t max_age_seconds) {
+  // Challenges of other DRM types are generated from the PSSH data found by
+  // the player, while the DRM manager parses PlayReady manifests by itself.
+  if (drm_type != DRM_TYPE_PLAYREADAY) {
+    LOG_ERROR("[DrmManager] Only PlayReady licenses can be prefetched.");
+    return false;
+  }
+  if (license_server_url.empty() || max_age_seconds <= 0) {
+    LOG_ERROR("[DrmManager] Invalid license prefetch parameters.");
+    return false;
+  }
+  LOG_INFO("[DrmManager] Prefetch license of %s", media_url.c_str());
+
+  if (!CreateDrmSession(drm_type, false)) {
+    return false;
+  }
+  SetLicenseCache(max_age_seconds, false);
+  if (!SetChallenge(media_url, license_server_url)) {
+    LOG_ERROR("[DrmManager] Fail to set challenge for prefetch.");
+    ReleaseDrmSession();
+    return false;
+  }
+  return true;
+}
+
+void DrmManager::AddPsshData(const void *data, size_t length) {
+  std::vector<std::string> payloads =
+      DrmLicenseCache::ParsePsshPayloads(data, length);
+  std::lock_guard<std::mutex> lock(pssh_mutex_);
+  for (std::string &payload : payloads) {
+    if (std::find(pssh_payloads_.begin(), pssh_payloads_.end(), payload) ==
+        pssh_payloads_.end()) {
+      pssh_payloads_.push_back(std::move(payload));
+    }
+  }
+}
+
+std::string DrmManager::GetLicenseCacheKey(const std::string &message) {
+  // The key is computed even if caching is disabled for this session so that
+  // prefetched licenses can be used.
+  std::string content_id;
+  {
+    std::lock_guard<std::mutex> lock(pssh_mutex_);
+    content_id = DrmLicenseCache::GetContentId(message, pssh_payloads_);
+  }
+  if (content_id.empty()) {
+    LOG_INFO("[DrmManager] Unknown keys requested, license is not cached.");
+    return std::string();
+  }
+  return DrmLicenseCache::MakeKey(license_server_url_, drm_type_, content_id);
+}
+
+void DrmManager::MarkStartupStage(StartupTimeline::Stage stage) {
+  if (startup_timeline_) {
+    startup_timeline_->Mark(stage);
+  }
+}
+
+void DrmManager::StoreLicense(const std::string &cache_key,
+                              const std::string &response) {
+  if (cache_key.empty() || license_cache_max_age_ <= 0) {
+    return;
   }
+  DrmLicenseCache::GetInstance().Store(cache_key, response,
+                                       license_cache_max_age_,
+                                       persist_license_cache_);
 }
@@ -8,8 +8,16 @@
 #include <Ecore.h>
 #include <flutter/method_channel.h>
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <queue>
+#include <string>
+#include <vector>
+
+#include "drm_license_helper.h"
+#include "startup_timeline.h"
 
 class DrmManager {
  public:
@@ -38,6 +46,23 @@ class DrmManager {
   void ReleaseDrmSession();
   void SetErrorCallback(ErrorCallback callback);
   void SendInstallKeyError();
+  // Enables caching of license responses for |max_age_seconds|. Cached
+  // responses are installed without contacting the license server when the
+  // same keys are requested again. If |persistent| is true, responses are
+  // also stored encrypted in the app data directory.
+  void SetLicenseCache(int64_t max_age_seconds, bool persistent);
+  // Acquires the licenses of |media_url| from |license_server_url| ahead of
+  // playback and caches them for |max_age_seconds|, so that a player created
+  // later for the same content does not wait for the license server. The
+  // session must be kept alive until the licenses are received.
+  bool PrefetchLicense(const std::string &media_url, int drm_type,
+                       const std::string &license_server_url,
+                       int64_t max_age_seconds);
+  // Records the DRM stages of the player start-up in |timeline|, which must
+  // outlive this object.
+  void SetStartupTimeline(StartupTimeline *timeline) {
+    startup_timeline_ = timeline;
+  }
 
  private:
   struct DataForLicenseProcess {
@@ -48,7 +73,48 @@ class DrmManager {
     std::string message;
   };
 
-  void RequestLicense(std::string &session_id, std::string &message);
+  // A license request that is in flight or waiting to be installed.
+  // |completed|, |succeeded| and |response| are guarded by the mutex of
+  // |license_workers_|.
+  struct PendingLicense {
+    std::string session_id;
+    std::string message;
+    std::string cache_key;
+    std::string response;
+    bool from_cache = false;
+    bool completed = false;
+    bool succeeded = false;
+    DrmLicenseHelper::SExtensionCtxTZ http_ext_ctx;
+  };
+
+  // State shared with the license workers. The workers are detached so that
+  // destroying the manager does not wait for transactions in flight, and may
+  // outlive the manager. Workers exit when they have been idle for a while
+  // and are started again on demand.
+  struct LicenseWorkerState {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::queue<std::shared_ptr<PendingLicense>> transaction_queue;
+    std::string license_server_url;
+    DrmLicenseHelper::DrmType drm_type = DrmLicenseHelper::kNone;
+    size_t worker_count = 0;
+    size_t idle_worker_count = 0;
+    bool stopped = false;
+    // Held while a worker reports a result to |owner|, which is cleared when
+    // the manager is destroyed.
+    std::mutex owner_mutex;
+    DrmManager *owner = nullptr;
+  };
+
+  bool RequestLicense(const std::shared_ptr<PendingLicense> &license);
+  void RequestLicenseFromDart(const std::shared_ptr<PendingLicense> &license);
+  void CompleteLicense(const std::shared_ptr<PendingLicense> &license,
+                       bool succeeded, std::string response);
+  void InstallCompletedLicenses();
+  void CancelLicenseRequests();
+  void StartLicenseWorkers();
+  void StopLicenseWorkers();
+  static void RunLicenseWorker(std::shared_ptr<LicenseWorkerState> state);
   bool InstallKey(void *session_id, void *response_data, void *response_len);
   int SetChallenge(const std::string &media_url);
 
@@ -57,6 +123,10 @@ class DrmManager {
   static void OnDrmManagerError(long error_code, char *error_message,
                                 void *user_data);
   bool ProcessLicense(DataForLicenseProcess &data);
+  void AddPsshData(const void *data, size_t length);
+  void MarkStartupStage(StartupTimeline::Stage stage);
+  std::string GetLicenseCacheKey(const std::string &message);
+  void StoreLicense(const std::string &cache_key, const std::string &response);
   void PushLicenseRequestData(DataForLicenseProcess &data);
   void ExecuteRequest();
 
@@ -70,7 +140,16 @@ class DrmManager {
   std::mutex queue_mutex_;
   Ecore_Pipe *license_request_pipe_ = nullptr;
   std::queue<DataForLicenseProcess> license_request_queue_;
+  Ecore_Pipe *license_response_pipe_ = nullptr;
+  // Accessed only on the main thread, in the order challenges were received.
+  std::deque<std::shared_ptr<PendingLicense>> pending_licenses_;
+  std::shared_ptr<LicenseWorkerState> license_workers_;
   ErrorCallback error_callback_;
+  int64_t license_cache_max_age_ = 0;
+  bool persist_license_cache_ = false;
+  std::mutex pssh_mutex_;
+  std::vector<std::string> pssh_payloads_;
+  StartupTimeline *startup_timeline_ = nullptr;
 };
 
 #endif  // FLUTTER_PLUGIN_DRM_MANAGER_H_
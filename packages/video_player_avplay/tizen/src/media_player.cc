@@ -8,6 +8,7 @@
 
 #include <sstream>
 
+#include "drm_license_helper.h"
 #include "log.h"
 
 namespace video_player_avplay_tizen {
@@ -76,6 +77,8 @@ MediaPlayer::~MediaPlayer() {
 int64_t MediaPlayer::Create(const std::string &uri,
                             const CreateMessage &create_message) {
   LOG_INFO("[MediaPlayer] uri: %s.", uri.c_str());
+  startup_timeline_.Start(flutter_common::GetValue(
+      create_message.player_options(), "logStartupReport", false));
 
   if (uri.empty()) {
     LOG_ERROR("[MediaPlayer] The uri must not be empty.");
@@ -126,10 +129,23 @@ int64_t MediaPlayer::Create(const std::string &uri,
   std::string license_server_url = flutter_common::GetValue(
       create_message.drm_configs(), "licenseServerUrl", std::string());
   if (drm_type != 0) {
+    int64_t connection_idle_timeout = flutter_common::GetIntegerValue(
+        create_message.drm_configs(), "licenseConnectionIdleTimeout", -1);
+    if (connection_idle_timeout >= 0) {
+      DrmLicenseHelper::SetConnectionIdleTimeout(connection_idle_timeout);
+    }
     if (!SetDrm(uri, drm_type, license_server_url)) {
       LOG_ERROR("[MediaPlayer] Fail to set drm.");
       return -1;
     }
+    int64_t license_cache_max_age = flutter_common::GetIntegerValue(
+        create_message.drm_configs(), "licenseCacheMaxAge", 0);
+    if (license_cache_max_age > 0) {
+      drm_manager_->SetLicenseCache(
+          license_cache_max_age,
+          flutter_common::GetValue(create_message.drm_configs(),
+                                   "persistLicenseCache", false));
+    }
   }
 
   if (!SetDisplay()) {
@@ -146,6 +162,7 @@ int64_t MediaPlayer::Create(const std::string &uri,
               get_error_message(ret));
     return -1;
   }
+  startup_timeline_.Mark(StartupTimeline::kOpened);
 
   ret = player_set_display_visible(player_, true);
   if (ret != PLAYER_ERROR_NONE) {
@@ -195,6 +212,10 @@ int64_t MediaPlayer::Create(const std::string &uri,
               get_error_message(ret));
     return -1;
   }
+  startup_timeline_.Mark(StartupTimeline::kPrepareStarted);
+
+  StartPositionUpdates(flutter_common::GetIntegerValue(
+      create_message.player_options(), "positionUpdateInterval", 0));
 
   return SetUpEventChannel();
 }
@@ -238,6 +259,7 @@ bool MediaPlayer::Play() {
     LOG_ERROR("[MediaPlayer] player_start failed: %s.", get_error_message(ret));
     return false;
   }
+  startup_timeline_.Mark(StartupTimeline::kPlaying);
   SendIsPlayingState(true);
   return true;
 }
@@ -300,6 +322,7 @@ bool MediaPlayer::SetPlaybackSpeed(double speed) {
               get_error_message(ret));
     return false;
   }
+  position_clock_.SetRate(speed);
   return true;
 }
 
@@ -307,10 +330,12 @@ bool MediaPlayer::SeekTo(int64_t position, SeekCompletedCallback callback) {
   LOG_INFO("[MediaPlayer] position: %lld.", position);
 
   on_seek_completed_ = std::move(callback);
+  position_clock_.Seek(position);
   int ret =
       player_set_play_position(player_, position, true, OnSeekCompleted, this);
   if (ret != PLAYER_ERROR_NONE) {
     on_seek_completed_ = nullptr;
+    position_clock_.SeekCompleted();
     LOG_ERROR("[MediaPlayer] player_set_play_position failed: %s.",
               get_error_message(ret));
     return false;
@@ -601,6 +626,7 @@ bool MediaPlayer::SetTrackSelection(int32_t track_id, std::string track_type) {
 bool MediaPlayer::SetDrm(const std::string &uri, int drm_type,
                          const std::string &license_server_url) {
   drm_manager_ = std::make_unique<DrmManager>();
+  drm_manager_->SetStartupTimeline(&startup_timeline_);
   if (!drm_manager_->CreateDrmSession(drm_type, false)) {
     LOG_ERROR("[MediaPlayer] Failed to create drm session.");
     return false;
@@ -662,6 +688,7 @@ void MediaPlayer::OnPrepared(void *user_data) {
   LOG_INFO("[MediaPlayer] Player prepared.");
 
   MediaPlayer *self = static_cast<MediaPlayer *>(user_data);
+  self->startup_timeline_.Mark(StartupTimeline::kPrepared);
   if (!self->is_initialized_) {
     self->SendInitialized();
   }
@@ -690,6 +717,7 @@ void MediaPlayer::OnSeekCompleted(void *user_data) {
   LOG_INFO("[MediaPlayer] Seek completed.");
 
   MediaPlayer *self = static_cast<MediaPlayer *>(user_data);
+  self->position_clock_.SeekCompleted();
   if (self->on_seek_completed_) {
     self->on_seek_completed_();
     self->on_seek_completed_ = nullptr;
@@ -832,6 +860,7 @@ bool MediaPlayer::Suspend() {
     LOG_ERROR("[MediaPlayer] Player not created.");
     return false;
   }
+  StopPositionUpdates();
 
   player_state_e player_state = PLAYER_STATE_NONE;
   int res = player_get_state(player_, &player_state);
@@ -889,6 +918,7 @@ bool MediaPlayer::Suspend() {
 bool MediaPlayer::Restore(const CreateMessage *restore_message,
                           int64_t resume_time) {
   LOG_INFO("[MediaPlayer] Restore is called.");
+  ResumePositionUpdates();
 
   player_state_e player_state = PLAYER_STATE_NONE;
   if (player_) {
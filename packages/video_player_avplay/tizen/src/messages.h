@@ -598,6 +598,18 @@ class VideoPlayerAvplayApi {
                                         const std::string& dash_token) = 0;
   virtual ErrorOr<TrackMessage> GetActiveTrackInfo(
       const PlayerMessage& msg) = 0;
+  virtual ErrorOr<bool> PrefetchLicense(const std::string& uri,
+                                        int64_t drm_type,
+                                        const std::string& license_server_url,
+                                        int64_t license_cache_max_age) = 0;
+  virtual ErrorOr<bool> Preload(const CreateMessage& msg) = 0;
+  virtual std::optional<FlutterError> ReleasePreloadedPlayers() = 0;
+  virtual ErrorOr<flutter::EncodableMap> GetStartupReport(
+      int64_t player_id) = 0;
+  virtual ErrorOr<PositionMessage> EstimatedPosition(
+      const PlayerMessage& msg) = 0;
+  virtual ErrorOr<flutter::EncodableMap> GetAbrTelemetry(
+      int64_t player_id) = 0;
 
   // The codec used by VideoPlayerAvplayApi.
   static const flutter::StandardMessageCodec& GetCodec();
@@ -0,0 +1,79 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "player_preloader.h"
+
+#include "log.h"
+
+namespace video_player_avplay_tizen {
+
+bool PlayerPreloader::Contains(const std::string &uri,
+                               const flutter::EncodableValue &options) {
+  auto iter = Find(uri, options);
+  if (iter == entries_.end()) {
+    return false;
+  }
+  entries_.splice(entries_.begin(), entries_, iter);
+  return true;
+}
+
+void PlayerPreloader::Add(const std::string &uri,
+                          const flutter::EncodableValue &options,
+                          int64_t player_id,
+                          std::unique_ptr<VideoPlayer> player) {
+  entries_.push_front({uri, options, player_id, std::move(player)});
+  while (entries_.size() > max_players_) {
+    LOG_INFO("[PlayerPreloader] Release the preloaded player for %s.",
+             entries_.back().uri.c_str());
+    Release(entries_.back());
+    entries_.pop_back();
+  }
+}
+
+std::unique_ptr<VideoPlayer> PlayerPreloader::Take(
+    const std::string &uri, const flutter::EncodableValue &options,
+    int64_t *player_id) {
+  auto iter = Find(uri, options);
+  if (iter == entries_.end()) {
+    return nullptr;
+  }
+  std::unique_ptr<VideoPlayer> player = std::move(iter->player);
+  *player_id = iter->player_id;
+  entries_.erase(iter);
+  return player;
+}
+
+void PlayerPreloader::Clear() {
+  for (Entry &entry : entries_) {
+    Release(entry);
+  }
+  entries_.clear();
+}
+
+std::list<PlayerPreloader::Entry>::iterator PlayerPreloader::Find(
+    const std::string &uri, const flutter::EncodableValue &options) {
+  for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+    if (iter->uri != uri) {
+      continue;
+    }
+    if (iter->options == options) {
+      return iter;
+    }
+    LOG_INFO("[PlayerPreloader] Options changed, release the player for %s.",
+             uri.c_str());
+    Release(*iter);
+    entries_.erase(iter);
+    break;
+  }
+  return entries_.end();
+}
+
+void PlayerPreloader::Release(Entry &entry) {
+  if (entry.player) {
+    entry.player->Dispose();
+    entry.player.reset();
+  }
+}
+
+}  // namespace video_player_avplay_tizen
@@ -0,0 +1,78 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_PLAYER_PRELOADER_H_
+#define FLUTTER_PLUGIN_PLAYER_PRELOADER_H_
+
+#include <flutter/encodable_value.h>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+
+#include "video_player.h"
+
+namespace video_player_avplay_tizen {
+
+// Keeps players prepared on sources that are likely to be played next (e.g.
+// the neighbouring channels of the current channel) so that switching to one
+// of them does not wait for the stream to be opened and buffered.
+//
+// Preloaded players are created in prebuffer mode, in which no hardware
+// decoder is acquired until the player is activated. The number of players
+// is still bounded, because every player buffers its own stream. When the
+// limit is reached, the least recently preloaded player is released.
+class PlayerPreloader {
+ public:
+  explicit PlayerPreloader(size_t max_players) : max_players_(max_players) {}
+  ~PlayerPreloader() { Clear(); }
+
+  PlayerPreloader(const PlayerPreloader &) = delete;
+  PlayerPreloader &operator=(const PlayerPreloader &) = delete;
+
+  // Returns whether a player for |uri| created with |options| is held, and
+  // marks it as the most recently preloaded one if so. A player for |uri|
+  // created with other options is released.
+  bool Contains(const std::string &uri, const flutter::EncodableValue &options);
+
+  // Takes ownership of |player|, which was created for |uri| with |options|
+  // and |player_id|.
+  void Add(const std::string &uri, const flutter::EncodableValue &options,
+           int64_t player_id, std::unique_ptr<VideoPlayer> player);
+
+  // Removes the player for |uri| and returns it if it was created with
+  // |options|, or returns nullptr otherwise. A player for |uri| created with
+  // other options is released.
+  std::unique_ptr<VideoPlayer> Take(const std::string &uri,
+                                    const flutter::EncodableValue &options,
+                                    int64_t *player_id);
+
+  // Releases all players.
+  void Clear();
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    std::string uri;
+    flutter::EncodableValue options;
+    int64_t player_id;
+    std::unique_ptr<VideoPlayer> player;
+  };
+
+  // Returns the entry for |uri|, or entries_.end() if there is none. An
+  // entry created with other options is released and removed.
+  std::list<Entry>::iterator Find(const std::string &uri,
+                                  const flutter::EncodableValue &options);
+  void Release(Entry &entry);
+
+  size_t max_players_;
+  // Most recently preloaded first.
+  std::list<Entry> entries_;
+};
+
+}  // namespace video_player_avplay_tizen
+
+#endif  // FLUTTER_PLUGIN_PLAYER_PRELOADER_H_
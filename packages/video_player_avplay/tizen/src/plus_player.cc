@@ -5,23 +5,93 @@
 #include "plus_player.h"
 
 #include <app_manager.h>
+#include <string.h>
 #include <system_info.h>
 
+#include <cstdlib>
+#include <limits>
 #include <sstream>
 
+#include "drm_license_helper.h"
 #include "log.h"
 #include "rapidjson/document.h"
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/writer.h"
 
-#define STB_IMAGE_WRITE_IMPLEMENTATION
-#include "stb_image_write.h"
-
 #define SUBTITLE_ATTR_TYPE_COUNT 37
 #define SUBTITLE_DEFAULT_TEXT_LINE 1
 
+// Logs every subtitle attribute and its value. Styled cues can carry dozens
+// of attributes, so these logs are compiled in only when
+// SUBTITLE_ATTRIBUTE_LOGS is defined (e.g. via USER_CPP_DEFS).
+#ifdef SUBTITLE_ATTRIBUTE_LOGS
+#define LOG_SUBTITLE_ATTRIBUTE(fmt, args...) LOG_INFO(fmt, ##args)
+#else
+#define LOG_SUBTITLE_ATTRIBUTE(fmt, args...)
+#endif
+
+// The size of a packed subtitle attribute record. See
+// AppendPackedSubtitleAttribute.
+#define PACKED_SUBTITLE_ATTR_SIZE 16
+
 namespace video_player_avplay_tizen {
 
+// The value kinds of packed subtitle attribute records.
+enum PackedSubtitleValueKind : uint8_t {
+  kPackedSubtitleValueNone = 0,
+  kPackedSubtitleValueFloat = 1,
+  kPackedSubtitleValueInt = 2,
+  kPackedSubtitleValueUint = 3,
+  kPackedSubtitleValueString = 4,
+};
+
+static void WriteUint32LE(uint8_t *dest, uint32_t value) {
+  dest[0] = value & 0xff;
+  dest[1] = (value >> 8) & 0xff;
+  dest[2] = (value >> 16) & 0xff;
+  dest[3] = (value >> 24) & 0xff;
+}
+
+// Appends a fixed-size little-endian record to |records|:
+//
+//   offset 0: attribute type (uint8)
+//   offset 1: value kind (uint8, PackedSubtitleValueKind)
+//   offset 2: reserved (uint16)
+//   offset 4: start time (uint32)
+//   offset 8: stop time (uint32)
+//   offset 12: value (float32, int32, uint32 or an index into |strings|)
+static void AppendPackedSubtitleAttribute(
+    const plusplayer::SubtitleAttribute &attr,
+    const flutter::EncodableValue &value, std::vector<uint8_t> *records,
+    flutter::EncodableList *strings) {
+  uint8_t kind = kPackedSubtitleValueNone;
+  uint32_t bits = 0;
+  if (std::holds_alternative<double>(value)) {
+    float value_float = static_cast<float>(std::get<double>(value));
+    memcpy(&bits, &value_float, sizeof(bits));
+    kind = kPackedSubtitleValueFloat;
+  } else if (std::holds_alternative<int32_t>(value)) {
+    bits = static_cast<uint32_t>(std::get<int32_t>(value));
+    kind = kPackedSubtitleValueInt;
+  } else if (std::holds_alternative<int64_t>(value)) {
+    bits = static_cast<uint32_t>(std::get<int64_t>(value));
+    kind = kPackedSubtitleValueUint;
+  } else if (std::holds_alternative<std::string>(value)) {
+    bits = static_cast<uint32_t>(strings->size());
+    strings->push_back(value);
+    kind = kPackedSubtitleValueString;
+  }
+
+  size_t offset = records->size();
+  records->resize(offset + PACKED_SUBTITLE_ATTR_SIZE, 0);
+  uint8_t *record = records->data() + offset;
+  record[0] = static_cast<uint8_t>(attr.type);
+  record[1] = kind;
+  WriteUint32LE(record + 4, attr.start_time);
+  WriteUint32LE(record + 8, attr.stop_time);
+  WriteUint32LE(record + 12, bits);
+}
+
 static std::vector<std::string> split(const std::string &s, char delim) {
   std::stringstream ss(s);
   std::string item;
@@ -80,6 +150,7 @@ PlusPlayer::~PlusPlayer() {
     DestroyPlayer(player_);
     player_ = nullptr;
   }
+  subtitle_picture_encoder_.reset();
 
   if (drm_manager_) {
     drm_manager_->ReleaseDrmSession();
@@ -106,6 +177,8 @@ void PlusPlayer::RegisterListener() {
 int64_t PlusPlayer::Create(const std::string &uri,
                            const CreateMessage &create_message) {
   LOG_INFO("[PlusPlayer] Create player.");
+  startup_timeline_.Start(flutter_common::GetValue(
+      create_message.player_options(), "logStartupReport", false));
 
   std::string video_format;
 
@@ -128,6 +201,7 @@ int64_t PlusPlayer::Create(const std::string &uri,
     LOG_ERROR("[PlusPlayer] Fail to open uri :  %s.", uri.c_str());
     return -1;
   }
+  startup_timeline_.Mark(StartupTimeline::kOpened);
   url_ = uri;
   create_message_ = create_message;
   LOG_INFO("[PlusPlayer] Uri: %s", uri.c_str());
@@ -149,6 +223,9 @@ int64_t PlusPlayer::Create(const std::string &uri,
   SetAppId(player_, std::string(appId));
   free(appId);
 
+  abr_controller_ = std::make_unique<AbrController>(
+      AbrController::CreatePolicy(create_message.player_options()),
+      [this](int64_t max_bandwidth) { return SetMaxBandwidth(max_bandwidth); });
   RegisterListener();
 
   int64_t drm_type = flutter_common::GetValue(create_message.drm_configs(),
@@ -156,10 +233,23 @@ int64_t PlusPlayer::Create(const std::string &uri,
   std::string license_server_url = flutter_common::GetValue(
       create_message.drm_configs(), "licenseServerUrl", std::string());
   if (drm_type != 0) {
+    int64_t connection_idle_timeout = flutter_common::GetIntegerValue(
+        create_message.drm_configs(), "licenseConnectionIdleTimeout", -1);
+    if (connection_idle_timeout >= 0) {
+      DrmLicenseHelper::SetConnectionIdleTimeout(connection_idle_timeout);
+    }
     if (!SetDrm(uri, drm_type, license_server_url)) {
       LOG_ERROR("[PlusPlayer] Fail to set drm.");
       return -1;
     }
+    int64_t license_cache_max_age = flutter_common::GetIntegerValue(
+        create_message.drm_configs(), "licenseCacheMaxAge", 0);
+    if (license_cache_max_age > 0) {
+      drm_manager_->SetLicenseCache(
+          license_cache_max_age,
+          flutter_common::GetValue(create_message.drm_configs(),
+                                   "persistLicenseCache", false));
+    }
   }
 
   if (!SetDisplay()) {
@@ -176,6 +266,9 @@ int64_t PlusPlayer::Create(const std::string &uri,
     is_prebuffer_mode_ = true;
   }
 
+  packed_subtitle_attributes_ = flutter_common::GetValue(
+      create_message.player_options(), "packedSubtitleAttributes", false);
+
   int64_t start_position = flutter_common::GetValue(
       create_message.player_options(), "startPosition", (int64_t)0);
   if (start_position > 0) {
@@ -189,6 +282,11 @@ int64_t PlusPlayer::Create(const std::string &uri,
     LOG_ERROR("[PlusPlayer] Player fail to prepare.");
     return -1;
   }
+  startup_timeline_.Mark(StartupTimeline::kPrepareStarted);
+
+  StartPositionUpdates(flutter_common::GetIntegerValue(
+      create_message.player_options(), "positionUpdateInterval", 0));
+
   return SetUpEventChannel();
 }
 
@@ -223,6 +321,9 @@ bool PlusPlayer::Play() {
       LOG_ERROR("[PlusPlayer] Player fail to start.");
       return false;
     }
+    if (abr_controller_) {
+      abr_controller_->OnPlaybackStarted();
+    }
     return true;
   } else if (state == plusplayer::State::kPaused) {
     if (!Resume(player_)) {
@@ -247,6 +348,14 @@ bool PlusPlayer::Activate() {
     LOG_ERROR("[PlusPlayer] Fail to activate subtitle.");
   }
 
+  // From now on the player behaves like any other player, also when it is
+  // recreated by Restore().
+  is_prebuffer_mode_ = false;
+  if (create_message_.player_options()) {
+    flutter::EncodableMap player_options = *create_message_.player_options();
+    player_options.erase(flutter::EncodableValue("prebufferMode"));
+    create_message_.set_player_options(player_options);
+  }
   return true;
 }
 
@@ -328,6 +437,7 @@ bool PlusPlayer::SetPlaybackSpeed(double speed) {
     LOG_ERROR("[PlusPlayer] Player fail to set playback rate.");
     return false;
   }
+  position_clock_.SetRate(speed);
   return true;
 }
 
@@ -345,8 +455,10 @@ bool PlusPlayer::SeekTo(int64_t position, SeekCompletedCallback callback) {
   }
 
   on_seek_completed_ = std::move(callback);
+  position_clock_.Seek(position);
   if (!Seek(player_, position)) {
     on_seek_completed_ = nullptr;
+    position_clock_.SeekCompleted();
     LOG_ERROR("[PlusPlayer] Player fail to seek.");
     return false;
   }
@@ -548,6 +660,15 @@ flutter::EncodableList PlusPlayer::GetTrackInfo(std::string track_type) {
   }
 
   plusplayer::TrackType type = ConvertTrackType(track_type);
+  uint64_t generation;
+  {
+    std::lock_guard<std::mutex> lock(track_cache_mutex_);
+    auto iter = track_info_cache_.find(type);
+    if (iter != track_info_cache_.end()) {
+      return iter->second;
+    }
+    generation = track_cache_generation_;
+  }
 
   int track_count = GetTrackCount(player_, type);
   if (track_count <= 0) {
@@ -584,6 +705,10 @@ flutter::EncodableList PlusPlayer::GetTrackInfo(std::string track_type) {
     }
   }
 
+  std::lock_guard<std::mutex> lock(track_cache_mutex_);
+  if (generation == track_cache_generation_) {
+    track_info_cache_[type] = trackSelections;
+  }
   return trackSelections;
 }
 
@@ -599,6 +724,15 @@ flutter::EncodableList PlusPlayer::GetActiveTrackInfo() {
     return {};
   }
 
+  uint64_t generation;
+  {
+    std::lock_guard<std::mutex> lock(track_cache_mutex_);
+    if (active_track_info_cache_) {
+      return *active_track_info_cache_;
+    }
+    generation = track_cache_generation_;
+  }
+
   const std::vector<plusplayer::Track> track_info =
       ::GetActiveTrackInfo(player_);
 
@@ -616,9 +750,23 @@ flutter::EncodableList PlusPlayer::GetActiveTrackInfo() {
       active_tracks.push_back(ParseSubtitleTrack(track));
     }
   }
+
+  std::lock_guard<std::mutex> lock(track_cache_mutex_);
+  if (generation == track_cache_generation_) {
+    active_track_info_cache_ = active_tracks;
+  }
   return active_tracks;
 }
 
+void PlusPlayer::InvalidateTrackCache(bool all_tracks) {
+  std::lock_guard<std::mutex> lock(track_cache_mutex_);
+  track_cache_generation_++;
+  active_track_info_cache_.reset();
+  if (all_tracks) {
+    track_info_cache_.clear();
+  }
+}
+
 bool PlusPlayer::SetTrackSelection(int32_t track_id, std::string track_type) {
   LOG_INFO("[PlusPlayer] Track id is: %d,track type is: %s", track_id,
            track_type.c_str());
@@ -638,12 +786,14 @@ bool PlusPlayer::SetTrackSelection(int32_t track_id, std::string track_type) {
     LOG_ERROR("[PlusPlayer] Player fail to select track.");
     return false;
   }
+  InvalidateTrackCache(false);
   return true;
 }
 
 bool PlusPlayer::SetDrm(const std::string &uri, int drm_type,
                         const std::string &license_server_url) {
   drm_manager_ = std::make_unique<DrmManager>();
+  drm_manager_->SetStartupTimeline(&startup_timeline_);
   DrmManager::ErrorCallback drm_error_callback =
       [this](const std::string &error_code, const std::string &error_message) {
         this->SendError(error_code, error_message);
@@ -804,6 +954,7 @@ bool PlusPlayer::StopAndClose() {
   }
 
   is_buffering_ = false;
+  InvalidateTrackCache(true);
   plusplayer::State player_state = GetState(player_);
   if (player_state < plusplayer::State::kReady) {
     LOG_INFO("[PlusPlayer] Player already stop, nothing to do.");
@@ -844,6 +995,7 @@ bool PlusPlayer::Suspend() {
     LOG_ERROR("[PlusPlayer] Player is in prebuffer mode, do nothing.");
     return true;
   }
+  StopPositionUpdates();
 
   memento_.reset(new plusplayer::PlayerMemento());
   if (!GetMemento(player_, memento_.get())) {
@@ -930,6 +1082,7 @@ bool PlusPlayer::Restore(const CreateMessage *restore_message,
     LOG_ERROR("[PlusPlayer] Player is in prebuffer mode, do nothing.");
     return true;
   }
+  ResumePositionUpdates();
 
   if (restore_message->uri()) {
     LOG_INFO(
@@ -1086,6 +1239,29 @@ bool PlusPlayer::SetData(const flutter::EncodableMap &data) {
   return ::SetData(player_, json_data);
 }
 
+bool PlusPlayer::SetMaxBandwidth(int64_t max_bandwidth) {
+  if (!player_) {
+    LOG_ERROR("[PlusPlayer] Player not created.");
+    return false;
+  }
+  // The player has no way to clear the cap, so lift it instead.
+  if (max_bandwidth <= 0) {
+    max_bandwidth = std::numeric_limits<int32_t>::max();
+  }
+  flutter::EncodableMap data = {
+      {flutter::EncodableValue("max-bandwidth"),
+       flutter::EncodableValue(max_bandwidth)},
+  };
+  return ::SetData(player_, BuildJsonString(data));
+}
+
+flutter::EncodableMap PlusPlayer::GetAbrTelemetry() {
+  if (!abr_controller_) {
+    return flutter::EncodableMap{};
+  }
+  return abr_controller_->GetTelemetry();
+}
+
 flutter::EncodableMap PlusPlayer::GetData(const flutter::EncodableList &data) {
   flutter::EncodableMap result;
   if (!player_) {
@@ -1127,6 +1303,10 @@ bool PlusPlayer::OnLicenseAcquired(int *drm_handle, unsigned int length,
 
 void PlusPlayer::OnPrepareDone(bool ret, void *user_data) {
   PlusPlayer *self = reinterpret_cast<PlusPlayer *>(user_data);
+  if (ret) {
+    self->startup_timeline_.Mark(StartupTimeline::kPrepared);
+  }
+  self->InvalidateTrackCache(true);
 
   if (!SetDisplayVisible(self->player_, true)) {
     LOG_ERROR("[PlusPlayer] Fail to set display visible.");
@@ -1143,12 +1323,18 @@ void PlusPlayer::OnBufferStatus(int percent, void *user_data) {
   LOG_INFO("[PlusPlayer] Buffering percent: %d.", percent);
   PlusPlayer *self = reinterpret_cast<PlusPlayer *>(user_data);
 
+  if (self->abr_controller_) {
+    self->abr_controller_->OnBufferLevelChanged(percent);
+  }
   if (percent == 100) {
     self->SendBufferingEnd();
     self->is_buffering_ = false;
   } else if (!self->is_buffering_ && percent <= 5) {
     self->SendBufferingStart();
     self->is_buffering_ = true;
+    if (self->abr_controller_) {
+      self->abr_controller_->OnRebufferingStarted();
+    }
   } else {
     self->SendBufferingUpdate(percent);
   }
@@ -1158,6 +1344,7 @@ void PlusPlayer::OnSeekDone(void *user_data) {
   LOG_INFO("[PlusPlayer] Seek completed.");
   PlusPlayer *self = reinterpret_cast<PlusPlayer *>(user_data);
 
+  self->position_clock_.SeekCompleted();
   if (self->on_seek_completed_) {
     self->on_seek_completed_();
     self->on_seek_completed_ = nullptr;
@@ -1203,27 +1390,29 @@ void PlusPlayer::OnSubtitleData(char *data, const int size,
 
   plusplayer::SubtitleAttributeList *attrs = attr_list.get();
 
+  bool packed = self->packed_subtitle_attributes_ &&
+                type != plusplayer::SubtitleType::kPicture;
   std::vector<flutter::EncodableList> attributes_lines(
-      text_lines_count, flutter::EncodableList());
+      packed ? 0 : text_lines_count, flutter::EncodableList());
+  std::vector<std::vector<uint8_t>> packed_attributes_lines(
+      packed ? text_lines_count : 0);
+  std::vector<flutter::EncodableList> attribute_strings_lines(
+      packed ? text_lines_count : 0);
+  for (std::vector<uint8_t> &records : packed_attributes_lines) {
+    records.reserve(attrs->size() * PACKED_SUBTITLE_ATTR_SIZE);
+  }
 
   for (auto attr = attrs->begin(); attr != attrs->end(); attr++) {
-    LOG_INFO(
+    LOG_SUBTITLE_ATTRIBUTE(
         "[PlusPlayer] SubtitleAttr update: attrType: %d, start: %u, end: %u.",
         attr->type, attr->start_time, attr->stop_time);
-    flutter::EncodableMap attributes = {
-        {flutter::EncodableValue("attrType"),
-         flutter::EncodableValue(attr->type)},
-        {flutter::EncodableValue("startTime"),
-         flutter::EncodableValue((int64_t)attr->start_time)},
-        {flutter::EncodableValue("stopTime"),
-         flutter::EncodableValue((int64_t)attr->stop_time)},
-    };
 
     if (attr->value == nullptr) {
       LOG_ERROR("[PlusPlayer] SubtitleAttr value is null");
       return;
     }
 
+    flutter::EncodableValue value;
     switch (attr->type) {
       case plusplayer::kSubAttrRegionXPos:
       case plusplayer::kSubAttrRegionYPos:
@@ -1239,10 +1428,9 @@ void PlusPlayer::OnSubtitleData(char *data, const int size,
       case plusplayer::kSubAttrWebvttCueSize:
       case plusplayer::kSubAttrWebvttCuePosition: {
         const float *value_float = static_cast<const float *>(attr->value);
-        LOG_INFO("[PlusPlayer] Subtitle update: value<float>: %f",
-                 *value_float);
-        attributes[flutter::EncodableValue("attrValue")] =
-            flutter::EncodableValue((double)*value_float);
+        LOG_SUBTITLE_ATTRIBUTE("[PlusPlayer] Subtitle update: value<float>: %f",
+                               *value_float);
+        value = flutter::EncodableValue((double)*value_float);
 
         if (attr->type == plusplayer::kSubAttrRegionWidth &&
             type == plusplayer::SubtitleType::kPicture) {
@@ -1271,18 +1459,16 @@ void PlusPlayer::OnSubtitleData(char *data, const int size,
       case plusplayer::kSubAttrWindowShowBg:
       case plusplayer::kSubAttrTimestamp: {
         const int *value_int = static_cast<const int *>(attr->value);
-        LOG_INFO("[PlusPlayer] Subtitle update: value<int>: %d", *value_int);
-        attributes[flutter::EncodableValue("attrValue")] =
-            flutter::EncodableValue(*value_int);
+        LOG_SUBTITLE_ATTRIBUTE("[PlusPlayer] Subtitle update: value<int>: %d",
+                               *value_int);
+        value = flutter::EncodableValue(*value_int);
       } break;
       case plusplayer::kSubAttrFontFamily:
       case plusplayer::kSubAttrRawSubtitle: {
         const char *value_chars = static_cast<const char *>(attr->value);
-        LOG_INFO("[PlusPlayer] Subtitle update: value<char *>: %s",
-                 value_chars);
-        std::string value_string(value_chars);
-        attributes[flutter::EncodableValue("attrValue")] =
-            flutter::EncodableValue(value_string);
+        LOG_SUBTITLE_ATTRIBUTE(
+            "[PlusPlayer] Subtitle update: value<char *>: %s", value_chars);
+        value = flutter::EncodableValue(std::string(value_chars));
       } break;
       case plusplayer::kSubAttrFontColor:
       case plusplayer::kSubAttrFontBgColor:
@@ -1290,10 +1476,9 @@ void PlusPlayer::OnSubtitleData(char *data, const int size,
       case plusplayer::kSubAttrFontTextOutlineColor: {
         const uint32_t *value_uint32 =
             static_cast<const uint32_t *>(attr->value);
-        LOG_INFO("[PlusPlayer] Subtitle update: value<uint32_t>: %u",
-                 *value_uint32);
-        attributes[flutter::EncodableValue("attrValue")] =
-            flutter::EncodableValue((int64_t)*value_uint32);
+        LOG_SUBTITLE_ATTRIBUTE(
+            "[PlusPlayer] Subtitle update: value<uint32_t>: %u", *value_uint32);
+        value = flutter::EncodableValue((int64_t)*value_uint32);
       } break;
       default:
         LOG_INFO("[PlusPlayer] Unknown Subtitle type: %d", attr->type);
@@ -1301,7 +1486,25 @@ void PlusPlayer::OnSubtitleData(char *data, const int size,
     }
 
     int index = line_attr_index[attr->type]--;
-    if (index >= 0) {
+    if (index < 0) {
+      continue;
+    }
+    if (packed) {
+      AppendPackedSubtitleAttribute(*attr, value,
+                                    &packed_attributes_lines[index],
+                                    &attribute_strings_lines[index]);
+    } else {
+      flutter::EncodableMap attributes = {
+          {flutter::EncodableValue("attrType"),
+           flutter::EncodableValue(attr->type)},
+          {flutter::EncodableValue("startTime"),
+           flutter::EncodableValue((int64_t)attr->start_time)},
+          {flutter::EncodableValue("stopTime"),
+           flutter::EncodableValue((int64_t)attr->stop_time)},
+      };
+      if (!value.IsNull()) {
+        attributes[flutter::EncodableValue("attrValue")] = std::move(value);
+      }
       attributes_lines[index].push_back(flutter::EncodableValue(attributes));
     }
   }
@@ -1326,36 +1529,34 @@ void PlusPlayer::OnSubtitleData(char *data, const int size,
         "[PlusPlayer] Subtitle is a picture: size: %d, width: %f, height: %f",
         size, picture_width, picture_height);
 
-    int subtitle_mem_length = 0;
     int channels = size / area;
     if (channels < 1 || channels > 4) {
       LOG_ERROR("[PlusPlayer] Invalid number of channels: %d", channels);
       return;
     }
-    int stride_in_bytes = static_cast<int>(picture_width) * channels;
 
-    unsigned char *subtitle_png = stbi_write_png_to_mem(
-        (const unsigned char *)data, stride_in_bytes,
-        static_cast<int>(picture_width), static_cast<int>(picture_height),
-        channels, &subtitle_mem_length);
-
-    if (subtitle_png && subtitle_mem_length > 0) {
-      std::vector<uint8_t> picture(subtitle_png,
-                                   subtitle_png + subtitle_mem_length);
-      flutter::EncodableMap picture_info = {
-          {flutter::EncodableValue("picture"),
-           flutter::EncodableValue(picture)},
-          {flutter::EncodableValue("pictureWidth"),
-           flutter::EncodableValue(picture_width)},
-          {flutter::EncodableValue("pictureHeight"),
-           flutter::EncodableValue(picture_height)},
-      };
-      self->SendSubtitleUpdate(duration, flutter::EncodableList(),
-                               picture_info);
-      STBIW_FREE(subtitle_png);
-    } else {
-      LOG_ERROR("[PlusPlayer] Picture subtitle data is null or size is 0.");
+    if (!self->subtitle_picture_encoder_) {
+      self->subtitle_picture_encoder_ =
+          std::make_unique<SubtitlePictureEncoder>(
+              [self](int64_t sequence, uint64_t duration,
+                     const std::vector<uint8_t> &png, double width,
+                     double height) {
+                flutter::EncodableMap picture_info = {
+                    {flutter::EncodableValue("picture"),
+                     flutter::EncodableValue(png)},
+                    {flutter::EncodableValue("pictureWidth"),
+                     flutter::EncodableValue(width)},
+                    {flutter::EncodableValue("pictureHeight"),
+                     flutter::EncodableValue(height)},
+                };
+                self->SendSubtitleUpdate(duration, flutter::EncodableList(),
+                                         picture_info, sequence);
+              });
     }
+    self->subtitle_picture_encoder_->Encode(
+        reinterpret_cast<const unsigned char *>(data),
+        static_cast<int>(picture_width), static_cast<int>(picture_height),
+        channels, duration, self->NextSubtitleSequence());
   } else {
     LOG_INFO(
         "[PlusPlayer] Subtitle is text: duration: %llu, text: %s, type: %d",
@@ -1365,9 +1566,16 @@ void PlusPlayer::OnSubtitleData(char *data, const int size,
       flutter::EncodableMap text_line = {
           {flutter::EncodableValue("text"),
            flutter::EncodableValue(text_lines[i])},
-          {flutter::EncodableValue("attributes"),
-           flutter::EncodableValue(attributes_lines[i])},
       };
+      if (packed) {
+        text_line[flutter::EncodableValue("packedAttributes")] =
+            flutter::EncodableValue(std::move(packed_attributes_lines[i]));
+        text_line[flutter::EncodableValue("attributeStrings")] =
+            flutter::EncodableValue(std::move(attribute_strings_lines[i]));
+      } else {
+        text_line[flutter::EncodableValue("attributes")] =
+            flutter::EncodableValue(std::move(attributes_lines[i]));
+      }
       texts_info.emplace_back(flutter::EncodableValue(text_line));
     }
 
@@ -1492,6 +1700,33 @@ void PlusPlayer::OnAdaptiveStreamingControlEvent(
   if (type == plusplayer::StreamingMessageType::kManifestUpdated) {
     self->SendManifestInfo(msg.data);
   }
+
+  switch (type) {
+    case plusplayer::StreamingMessageType::kBitrateChange:
+      self->InvalidateTrackCache(false);
+      break;
+    case plusplayer::StreamingMessageType::kSparseTrackDetect:
+    case plusplayer::StreamingMessageType::kStreamMrsUrlChanged:
+    case plusplayer::StreamingMessageType::kDashRemoveStream:
+    case plusplayer::StreamingMessageType::kDashLiveToVod:
+    case plusplayer::StreamingMessageType::kManifestUpdated:
+      self->InvalidateTrackCache(true);
+      break;
+    default:
+      break;
+  }
+  if (self->abr_controller_) {
+    if (type == plusplayer::StreamingMessageType::kBitrateChange) {
+      // The message carries the bitrate of the new representation.
+      self->abr_controller_->OnBitrateChanged(
+          std::strtoll(msg.data.c_str(), nullptr, 10));
+    } else if (type ==
+               plusplayer::StreamingMessageType::kFragmentDownloadInfo) {
+      self->abr_controller_->OnSegmentDownloaded(std::strtoll(
+          ::GetStreamingProperty(self->player_, "CURRENT_BANDWIDTH").c_str(),
+          nullptr, 10));
+    }
+  }
 }
 
 void PlusPlayer::OnClosedCaptionData(std::unique_ptr<char[]> data,
@@ -1511,6 +1746,7 @@ void PlusPlayer::OnChangeSourceDone(bool ret, void *user_data) {}
 
 void PlusPlayer::OnStateChangedToPlaying(void *user_data) {
   PlusPlayer *self = reinterpret_cast<PlusPlayer *>(user_data);
+  self->startup_timeline_.Mark(StartupTimeline::kPlaying);
   self->SendIsPlayingState(true);
 }
 
@@ -7,13 +7,18 @@
 
 #include <flutter/plugin_registrar.h>
 
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 
+#include "abr_controller.h"
 #include "device_proxy.h"
 #include "drm_manager.h"
 #include "messages.h"
 #include "plusplayer/plusplayer_wrapper.h"
+#include "subtitle_picture_encoder.h"
 #include "video_player.h"
 
 namespace video_player_avplay_tizen {
@@ -58,6 +63,7 @@ class PlusPlayer : public VideoPlayer {
   flutter::EncodableMap GetData(const flutter::EncodableList &data) override;
   bool UpdateDashToken(const std::string &dashToken) override;
   flutter::EncodableList GetActiveTrackInfo() override;
+  flutter::EncodableMap GetAbrTelemetry() override;
 
  private:
   bool IsLive();
@@ -71,6 +77,10 @@ class PlusPlayer : public VideoPlayer {
   void RegisterListener();
   bool StopAndClose();
   bool RestorePlayer(const CreateMessage *restore_message, int64_t resume_time);
+  bool SetMaxBandwidth(int64_t max_bandwidth);
+  // Clears the cached active tracks, and also the cached track lists if
+  // |all_tracks| is true.
+  void InvalidateTrackCache(bool all_tracks);
 
   static bool OnLicenseAcquired(int *drm_handle, unsigned int length,
                                 unsigned char *pssh_data, void *user_data);
@@ -108,11 +118,25 @@ class PlusPlayer : public VideoPlayer {
   std::unique_ptr<DrmManager> drm_manager_;
   bool is_buffering_ = false;
   bool is_prebuffer_mode_ = false;
+  // Whether subtitle attributes are sent as packed records instead of maps.
+  bool packed_subtitle_attributes_ = false;
   SeekCompletedCallback on_seek_completed_;
   std::unique_ptr<plusplayer::PlayerMemento> memento_ = nullptr;
   std::string url_;
   std::unique_ptr<DeviceProxy> device_proxy_ = nullptr;
   CreateMessage create_message_;
+  // Created on the first picture subtitle. Accessed on the player callback
+  // thread.
+  std::unique_ptr<SubtitlePictureEncoder> subtitle_picture_encoder_;
+  std::unique_ptr<AbrController> abr_controller_;
+  // Parsed results of GetTrackInfo() and GetActiveTrackInfo(). Invalidated
+  // from both the platform thread and the player callback thread.
+  std::mutex track_cache_mutex_;
+  std::map<plusplayer::TrackType, flutter::EncodableList> track_info_cache_;
+  std::optional<flutter::EncodableList> active_track_info_cache_;
+  // Incremented on every invalidation. A result queried from the player is
+  // cached only if no invalidation happened in the meantime.
+  uint64_t track_cache_generation_ = 0;
 };
 
 }  // namespace video_player_avplay_tizen
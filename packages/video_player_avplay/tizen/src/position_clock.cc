@@ -0,0 +1,105 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "position_clock.h"
+
+#include <chrono>
+
+namespace {
+
+int64_t NowMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+void PositionClock::Sample(int64_t position) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (is_seeking_) {
+    return;
+  }
+  base_position_ = position;
+  base_time_ = NowMs();
+  is_valid_ = true;
+}
+
+void PositionClock::Invalidate() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  is_valid_ = false;
+}
+
+void PositionClock::SetPlaying(bool is_playing) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Rebase();
+  is_playing_ = is_playing;
+  is_valid_ = false;
+}
+
+void PositionClock::SetBuffering(bool is_buffering) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Rebase();
+  is_buffering_ = is_buffering;
+  is_valid_ = false;
+}
+
+void PositionClock::SetRate(double rate) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Rebase();
+  rate_ = rate;
+}
+
+void PositionClock::Seek(int64_t position) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  base_position_ = position;
+  base_time_ = NowMs();
+  is_valid_ = true;
+  is_seeking_ = true;
+}
+
+void PositionClock::SeekCompleted() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  base_time_ = NowMs();
+  is_seeking_ = false;
+  is_valid_ = false;
+}
+
+bool PositionClock::NeedsSample(int64_t max_age_ms) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (is_seeking_) {
+    return false;
+  }
+  if (!is_valid_) {
+    return true;
+  }
+  return IsAdvancingLocked() && NowMs() - base_time_ >= max_age_ms;
+}
+
+bool PositionClock::IsAdvancing() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return IsAdvancingLocked();
+}
+
+int64_t PositionClock::GetPosition() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return GetPositionLocked(NowMs());
+}
+
+bool PositionClock::IsAdvancingLocked() const {
+  return is_playing_ && !is_buffering_ && !is_seeking_;
+}
+
+int64_t PositionClock::GetPositionLocked(int64_t now) const {
+  if (base_position_ < 0 || !IsAdvancingLocked()) {
+    return base_position_;
+  }
+  return base_position_ + static_cast<int64_t>((now - base_time_) * rate_);
+}
+
+void PositionClock::Rebase() {
+  int64_t now = NowMs();
+  base_position_ = GetPositionLocked(now);
+  base_time_ = now;
+}
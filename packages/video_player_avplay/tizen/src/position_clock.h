@@ -0,0 +1,61 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_POSITION_CLOCK_H_
+#define FLUTTER_PLUGIN_POSITION_CLOCK_H_
+
+#include <cstdint>
+#include <mutex>
+
+// Estimates the playback position between samples taken from the player by
+// advancing the last sample at the playback rate.
+//
+// State changes that make the estimate unreliable (play, pause, buffering,
+// seek completion) invalidate the current sample, so that the owner samples
+// the player again. All positions are in milliseconds. The methods may be
+// called from any thread.
+class PositionClock {
+ public:
+  PositionClock() = default;
+  PositionClock(const PositionClock &) = delete;
+  PositionClock &operator=(const PositionClock &) = delete;
+
+  void Sample(int64_t position);
+  void Invalidate();
+
+  void SetPlaying(bool is_playing);
+  void SetBuffering(bool is_buffering);
+  void SetRate(double rate);
+
+  // Holds the clock at |position| until SeekCompleted() is called, so that
+  // the stale position reported by the player during the seek is not used.
+  void Seek(int64_t position);
+  void SeekCompleted();
+
+  // Returns whether the player must be sampled, i.e. there is no valid
+  // sample, or the clock is advancing and the sample is older than
+  // |max_age_ms|.
+  bool NeedsSample(int64_t max_age_ms) const;
+
+  bool IsAdvancing() const;
+
+  // Returns the estimated position, or -1 if the player was never sampled.
+  int64_t GetPosition() const;
+
+ private:
+  bool IsAdvancingLocked() const;
+  int64_t GetPositionLocked(int64_t now) const;
+  void Rebase();
+
+  mutable std::mutex mutex_;
+  int64_t base_position_ = -1;
+  int64_t base_time_ = 0;
+  bool is_valid_ = false;
+  bool is_playing_ = false;
+  bool is_buffering_ = false;
+  bool is_seeking_ = false;
+  double rate_ = 1.0;
+};
+
+#endif  // FLUTTER_PLUGIN_POSITION_CLOCK_H_
@@ -0,0 +1,56 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "segment_cache.h"
+
+std::shared_ptr<const SegmentCache::Segment> SegmentCache::Lookup(
+    const std::string &key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = index_.find(key);
+  if (iter == index_.end()) {
+    return nullptr;
+  }
+  entries_.splice(entries_.begin(), entries_, iter->second);
+  return iter->second->segment;
+}
+
+bool SegmentCache::Contains(const std::string &key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return index_.find(key) != index_.end();
+}
+
+void SegmentCache::Store(const std::string &key,
+                         std::shared_ptr<const Segment> segment) {
+  size_t segment_size = segment->body.size();
+  if (segment_size > max_size_ / 4) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = index_.find(key);
+  if (iter != index_.end()) {
+    size_ -= iter->second->segment->body.size();
+    entries_.erase(iter->second);
+    index_.erase(iter);
+  }
+  while (!entries_.empty() && size_ + segment_size > max_size_) {
+    size_ -= entries_.back().segment->body.size();
+    index_.erase(entries_.back().key);
+    entries_.pop_back();
+    eviction_count_++;
+  }
+  entries_.push_front({key, std::move(segment)});
+  index_[key] = entries_.begin();
+  size_ += segment_size;
+}
+
+size_t SegmentCache::size() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return size_;
+}
+
+int64_t SegmentCache::eviction_count() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return eviction_count_;
+}
@@ -0,0 +1,57 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_SEGMENT_CACHE_H_
+#define FLUTTER_PLUGIN_SEGMENT_CACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// An in-memory LRU cache of media segments bounded by the total size of the
+// cached bodies. The methods may be called from any thread.
+class SegmentCache {
+ public:
+  struct Segment {
+    std::string content_type;
+    // The Content-Range header of a partial response, empty otherwise.
+    std::string content_range;
+    std::string body;
+  };
+
+  explicit SegmentCache(size_t max_size) : max_size_(max_size) {}
+  SegmentCache(const SegmentCache &) = delete;
+  SegmentCache &operator=(const SegmentCache &) = delete;
+
+  // Returns the segment stored for |key| and marks it as the most recently
+  // used one, or nullptr if there is none.
+  std::shared_ptr<const Segment> Lookup(const std::string &key);
+  bool Contains(const std::string &key);
+
+  // Stores |segment|, evicting the least recently used segments as needed.
+  // Segments larger than a quarter of the cache are not stored.
+  void Store(const std::string &key, std::shared_ptr<const Segment> segment);
+
+  size_t size();
+  int64_t eviction_count();
+
+ private:
+  struct Entry {
+    std::string key;
+    std::shared_ptr<const Segment> segment;
+  };
+
+  std::mutex mutex_;
+  size_t max_size_;
+  size_t size_ = 0;
+  int64_t eviction_count_ = 0;
+  // Most recently used first.
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+};
+
+#endif  // FLUTTER_PLUGIN_SEGMENT_CACHE_H_
@@ -0,0 +1,879 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "segment_cache_proxy.h"
+
+#include <arpa/inet.h>
+#include <curl/curl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <mutex>
+#include <sstream>
+
+#include "log.h"
+
+namespace {
+
+constexpr size_t kMaxRequestHeaderSize = 16 * 1024;
+constexpr int kSocketTimeoutSeconds = 10;
+constexpr long kConnectTimeoutSeconds = 10;
+// Downloads slower than 1 byte per second for this long are aborted.
+constexpr long kLowSpeedTimeSeconds = 20;
+constexpr size_t kMaxIdleHandles = 4;
+
+// Request headers that are not forwarded to the origin. Accept-Encoding is
+// dropped so that bodies are never compressed, since they are rewritten and
+// sliced by the proxy.
+const char *const kHopByHopHeaders[] = {
+    "host",       "connection", "keep-alive", "proxy-connection",
+    "te",         "upgrade",    "accept-encoding",
+};
+
+std::string ToLower(std::string value) {
+  std::transform(value.begin(), value.end(), value.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+  return value;
+}
+
+bool StartsWith(const std::string &value, const std::string &prefix) {
+  return value.compare(0, prefix.size(), prefix) == 0;
+}
+
+bool EndsWith(const std::string &value, const std::string &suffix) {
+  return value.size() >= suffix.size() &&
+         value.compare(value.size() - suffix.size(), suffix.size(), suffix) ==
+             0;
+}
+
+std::string StripQuery(const std::string &url) {
+  return url.substr(0, url.find_first_of("?#"));
+}
+
+bool IsHlsManifest(const std::string &url, const std::string &content_type) {
+  return EndsWith(ToLower(StripQuery(url)), ".m3u8") ||
+         ToLower(content_type).find("mpegurl") != std::string::npos;
+}
+
+bool IsDashManifest(const std::string &url, const std::string &content_type) {
+  return EndsWith(ToLower(StripQuery(url)), ".mpd") ||
+         ToLower(content_type).find("dash+xml") != std::string::npos;
+}
+
+// Resolves |reference| against |base_url|. Dot segments are left to the
+// origin server.
+std::string ResolveUrl(const std::string &base_url,
+                       const std::string &reference) {
+  if (reference.find("://") != std::string::npos) {
+    return reference;
+  }
+  size_t scheme_end = base_url.find("://");
+  if (scheme_end == std::string::npos) {
+    return reference;
+  }
+  if (StartsWith(reference, "//")) {
+    return base_url.substr(0, scheme_end + 1) + reference;
+  }
+  std::string base = StripQuery(base_url);
+  if (StartsWith(reference, "/")) {
+    size_t path_start = base.find('/', scheme_end + 3);
+    return base.substr(0, path_start) + reference;
+  }
+  return base.substr(0, base.rfind('/') + 1) + reference;
+}
+
+std::string EscapeRegex(const std::string &literal) {
+  std::string escaped;
+  for (char c : literal) {
+    if (std::string(".^$|()[]{}*+?\\").find(c) != std::string::npos) {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+  return escaped;
+}
+
+// Converts the last path component of a DASH SegmentTemplate media attribute
+// such as "$RepresentationID$/seg-$Number%05d$.m4s" into a regex that captures
+// the segment number. Returns false if the template is not $Number$ based.
+bool ParseNumberTemplate(const std::string &media, std::string *pattern,
+                         int *number_width) {
+  std::string name = media.substr(media.rfind('/') + 1);
+  if (name.find("$Number") == std::string::npos ||
+      media.find("$Time") != std::string::npos) {
+    return false;
+  }
+  *pattern = "/";
+  *number_width = 0;
+  size_t pos = 0;
+  while (pos < name.size()) {
+    size_t start = name.find('$', pos);
+    if (start == std::string::npos) {
+      *pattern += EscapeRegex(name.substr(pos));
+      break;
+    }
+    size_t end = name.find('$', start + 1);
+    if (end == std::string::npos) {
+      return false;
+    }
+    *pattern += EscapeRegex(name.substr(pos, start - pos));
+    std::string identifier = name.substr(start + 1, end - start - 1);
+    if (identifier.empty()) {
+      *pattern += "\\$";
+    } else if (identifier == "RepresentationID") {
+      *pattern += "[^/]*";
+    } else if (identifier == "Bandwidth") {
+      *pattern += "[0-9]+";
+    } else if (StartsWith(identifier, "Number")) {
+      std::string format = identifier.substr(6);
+      if (StartsWith(format, "%0")) {
+        *number_width = std::atoi(format.c_str() + 2);
+      }
+      *pattern += "([0-9]+)";
+    } else {
+      return false;
+    }
+    pos = end + 1;
+  }
+  *pattern += "$";
+  return true;
+}
+
+// Parses a non-negative decimal number that fills all of |value|.
+bool ParseNumber(const std::string &value, uint64_t *number) {
+  const char *first = value.data();
+  const char *last = first + value.size();
+  std::from_chars_result result = std::from_chars(first, last, *number);
+  return !value.empty() && result.ec == std::errc() && result.ptr == last;
+}
+
+// Returns the scheme and authority of |url|, e.g. "https://example.com:8080".
+std::string GetOrigin(const std::string &url) {
+  size_t scheme_end = url.find("://");
+  if (scheme_end == std::string::npos) {
+    return std::string();
+  }
+  size_t authority_end = url.find_first_of("/?#", scheme_end + 3);
+  return ToLower(url.substr(0, authority_end));
+}
+
+// Parses a single byte range such as "bytes=0-499", "bytes=500-" or
+// "bytes=-500" for a body of |size| bytes.
+bool ParseRange(const std::string &range, size_t size, size_t *start,
+                size_t *end) {
+  if (!StartsWith(range, "bytes=") || size == 0 ||
+      range.find(',') != std::string::npos) {
+    return false;
+  }
+  std::string spec = range.substr(6);
+  size_t dash = spec.find('-');
+  if (dash == std::string::npos) {
+    return false;
+  }
+  std::string first = spec.substr(0, dash);
+  std::string last = spec.substr(dash + 1);
+  uint64_t first_byte = 0;
+  uint64_t last_byte = size - 1;
+  if (first.empty()) {
+    uint64_t length = 0;
+    if (!ParseNumber(last, &length) || length == 0) {
+      return false;
+    }
+    first_byte = size - std::min<uint64_t>(length, size);
+  } else {
+    if (!ParseNumber(first, &first_byte) ||
+        (!last.empty() && !ParseNumber(last, &last_byte))) {
+      return false;
+    }
+    last_byte = std::min<uint64_t>(last_byte, size - 1);
+  }
+  if (first_byte > last_byte || first_byte >= size) {
+    return false;
+  }
+  *start = first_byte;
+  *end = last_byte;
+  return true;
+}
+
+const char *GetStatusText(long status) {
+  switch (status) {
+    case 200:
+      return "OK";
+    case 206:
+      return "Partial Content";
+    case 400:
+      return "Bad Request";
+    case 403:
+      return "Forbidden";
+    case 404:
+      return "Not Found";
+    case 405:
+      return "Method Not Allowed";
+    case 416:
+      return "Range Not Satisfiable";
+    case 502:
+      return "Bad Gateway";
+    default:
+      return "Unknown";
+  }
+}
+
+bool WriteAll(int fd, const char *data, size_t length) {
+  while (length > 0) {
+    ssize_t written = send(fd, data, length, MSG_NOSIGNAL);
+    if (written <= 0) {
+      return false;
+    }
+    data += written;
+    length -= written;
+  }
+  return true;
+}
+
+void SendResponse(int fd, bool is_head, long status,
+                  const std::string &content_type,
+                  const std::string &content_range, const char *body,
+                  size_t length) {
+  std::ostringstream header;
+  header << "HTTP/1.1 " << status << " " << GetStatusText(status) << "\r\n";
+  if (!content_type.empty()) {
+    header << "Content-Type: " << content_type << "\r\n";
+  }
+  if (!content_range.empty()) {
+    header << "Content-Range: " << content_range << "\r\n";
+  }
+  header << "Content-Length: " << length << "\r\n"
+         << "Accept-Ranges: bytes\r\n"
+         << "Connection: close\r\n\r\n";
+  std::string header_str = header.str();
+  if (!WriteAll(fd, header_str.data(), header_str.size())) {
+    return;
+  }
+  if (!is_head && length > 0) {
+    WriteAll(fd, body, length);
+  }
+}
+
+void SendError(int fd, long status) {
+  SendResponse(fd, false, status, "", "", nullptr, 0);
+}
+
+size_t WriteBody(char *data, size_t size, size_t count, void *user_data) {
+  static_cast<std::string *>(user_data)->append(data, size * count);
+  return size * count;
+}
+
+size_t WriteHeader(char *data, size_t size, size_t count, void *user_data) {
+  std::string line(data, size * count);
+  std::string *content_range = static_cast<std::string *>(user_data);
+  if (StartsWith(line, "HTTP/")) {
+    // A new response after a redirect.
+    content_range->clear();
+  } else if (StartsWith(ToLower(line), "content-range:")) {
+    std::string value = line.substr(14);
+    size_t start = value.find_first_not_of(" \t");
+    size_t end = value.find_last_not_of(" \t\r\n");
+    *content_range =
+        start == std::string::npos ? "" : value.substr(start, end - start + 1);
+  }
+  return size * count;
+}
+
+int OnTransferProgress(void *user_data, curl_off_t /*dltotal*/,
+                       curl_off_t /*dlnow*/, curl_off_t /*ultotal*/,
+                       curl_off_t /*ulnow*/) {
+  // Abort transfers when the proxy is stopped.
+  return static_cast<std::atomic<bool> *>(user_data)->load() ? 0 : 1;
+}
+
+}  // namespace
+
+SegmentCacheProxy::SegmentCacheProxy(size_t max_cache_size,
+                                     int prefetch_count)
+    : prefetch_count_(prefetch_count), cache_(max_cache_size) {}
+
+SegmentCacheProxy::~SegmentCacheProxy() { Stop(); }
+
+bool SegmentCacheProxy::Start() {
+  if (running_) {
+    return true;
+  }
+  // curl_global_init() is not thread safe, and the global state is shared
+  // with other users of libcurl in the process, so it is initialized once
+  // and never cleaned up.
+  static std::once_flag curl_init_flag;
+  std::call_once(curl_init_flag, [] { curl_global_init(CURL_GLOBAL_DEFAULT); });
+
+  listen_fd_ = socket(AF_INET, SOCK_STREAM, 0);
+  if (listen_fd_ < 0) {
+    LOG_ERROR("[SegmentCacheProxy] Fail to create a socket.");
+    return false;
+  }
+  int reuse = 1;
+  setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+  socklen_t address_length = sizeof(address);
+  if (bind(listen_fd_, reinterpret_cast<sockaddr *>(&address),
+           sizeof(address)) != 0 ||
+      listen(listen_fd_, SOMAXCONN) != 0 ||
+      getsockname(listen_fd_, reinterpret_cast<sockaddr *>(&address),
+                  &address_length) != 0) {
+    LOG_ERROR("[SegmentCacheProxy] Fail to listen on the loopback interface.");
+    close(listen_fd_);
+    listen_fd_ = -1;
+    return false;
+  }
+  port_ = ntohs(address.sin_port);
+  running_ = true;
+  accept_thread_ = std::thread(&SegmentCacheProxy::AcceptLoop, this);
+  prefetch_thread_ = std::thread(&SegmentCacheProxy::PrefetchLoop, this);
+  LOG_INFO("[SegmentCacheProxy] Listening on port %d.", port_);
+  return true;
+}
+
+void SegmentCacheProxy::Stop() {
+  if (!running_.exchange(false)) {
+    return;
+  }
+  // Wakes up the accept() call.
+  shutdown(listen_fd_, SHUT_RDWR);
+  if (accept_thread_.joinable()) {
+    accept_thread_.join();
+  }
+  close(listen_fd_);
+  listen_fd_ = -1;
+
+  {
+    std::unique_lock<std::mutex> lock(connection_mutex_);
+    for (int fd : connection_fds_) {
+      shutdown(fd, SHUT_RDWR);
+    }
+    connection_cv_.wait(lock, [this] { return active_connections_ == 0; });
+  }
+
+  prefetch_cv_.notify_all();
+  if (prefetch_thread_.joinable()) {
+    prefetch_thread_.join();
+  }
+  {
+    std::lock_guard<std::mutex> lock(prefetch_mutex_);
+    prefetch_queue_.clear();
+  }
+
+  std::lock_guard<std::mutex> lock(handle_mutex_);
+  for (void *handle : idle_handles_) {
+    curl_easy_cleanup(handle);
+  }
+  idle_handles_.clear();
+}
+
+std::string SegmentCacheProxy::GetProxyUrl(const std::string &url) {
+  size_t scheme_end = url.find("://");
+  if (!running_ || scheme_end == std::string::npos) {
+    return url;
+  }
+  std::string scheme = ToLower(url.substr(0, scheme_end));
+  if (scheme != "http" && scheme != "https") {
+    return url;
+  }
+  {
+    std::lock_guard<std::mutex> lock(origin_mutex_);
+    allowed_origins_.insert(GetOrigin(url));
+  }
+  return "http://127.0.0.1:" + std::to_string(port_) + "/" + scheme + "/" +
+         url.substr(scheme_end + 3);
+}
+
+SegmentCacheProxy::Statistics SegmentCacheProxy::GetStatistics() {
+  Statistics statistics;
+  statistics.hits = hits_;
+  statistics.misses = misses_;
+  statistics.prefetches = prefetches_;
+  statistics.evictions = cache_.eviction_count();
+  statistics.cached_size = cache_.size();
+  return statistics;
+}
+
+void SegmentCacheProxy::AcceptLoop() {
+  while (running_) {
+    int fd = accept(listen_fd_, nullptr, nullptr);
+    if (fd < 0) {
+      if (!running_) {
+        break;
+      }
+      continue;
+    }
+    timeval timeout = {kSocketTimeoutSeconds, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    std::lock_guard<std::mutex> lock(connection_mutex_);
+    connection_fds_.insert(fd);
+    active_connections_++;
+    std::thread([this, fd] {
+      HandleConnection(fd);
+      std::lock_guard<std::mutex> lock(connection_mutex_);
+      connection_fds_.erase(fd);
+      close(fd);
+      active_connections_--;
+      connection_cv_.notify_all();
+    }).detach();
+  }
+}
+
+void SegmentCacheProxy::HandleConnection(int fd) {
+  std::string buffer;
+  char chunk[4096];
+  while (buffer.find("\r\n\r\n") == std::string::npos) {
+    if (buffer.size() > kMaxRequestHeaderSize) {
+      SendError(fd, 400);
+      return;
+    }
+    ssize_t received = recv(fd, chunk, sizeof(chunk), 0);
+    if (received <= 0) {
+      return;
+    }
+    buffer.append(chunk, received);
+  }
+
+  std::istringstream stream(buffer.substr(0, buffer.find("\r\n\r\n")));
+  std::string line;
+  std::getline(stream, line);
+  std::istringstream request_line(line);
+  Request request;
+  std::string path;
+  request_line >> request.method >> path;
+
+  while (std::getline(stream, line)) {
+    if (!line.empty() && line.back() == '\r') {
+      line.pop_back();
+    }
+    size_t colon = line.find(':');
+    if (colon == std::string::npos) {
+      continue;
+    }
+    size_t value_start = line.find_first_not_of(" \t", colon + 1);
+    request.headers[ToLower(line.substr(0, colon))] =
+        value_start == std::string::npos ? "" : line.substr(value_start);
+  }
+
+  // Decode /<scheme>/<host>/<path> into <scheme>://<host>/<path>.
+  size_t scheme_end = path.find('/', 1);
+  std::string scheme =
+      scheme_end == std::string::npos ? "" : path.substr(1, scheme_end - 1);
+  if (scheme != "http" && scheme != "https") {
+    SendError(fd, 400);
+    return;
+  }
+  request.url = scheme + "://" + path.substr(scheme_end + 1);
+
+  if (request.method != "GET" && request.method != "HEAD") {
+    SendError(fd, 405);
+    return;
+  }
+  // Other local apps can connect to the proxy too. Only fetch from the
+  // origins of the streams being played.
+  {
+    std::lock_guard<std::mutex> lock(origin_mutex_);
+    if (allowed_origins_.count(GetOrigin(request.url)) == 0) {
+      LOG_ERROR("[SegmentCacheProxy] Origin not allowed: %s",
+                GetOrigin(request.url).c_str());
+      SendError(fd, 403);
+      return;
+    }
+  }
+  HandleRequest(fd, request);
+}
+
+void SegmentCacheProxy::HandleRequest(int fd, const Request &request) {
+  bool is_head = request.method == "HEAD";
+  auto range_iter = request.headers.find("range");
+  std::string range =
+      range_iter == request.headers.end() ? "" : range_iter->second;
+
+  Headers headers;
+  for (const auto &[name, value] : request.headers) {
+    if (std::find(std::begin(kHopByHopHeaders), std::end(kHopByHopHeaders),
+                  name) == std::end(kHopByHopHeaders)) {
+      headers[name] = value;
+    }
+  }
+  Headers prefetch_headers = headers;
+  prefetch_headers.erase("range");
+
+  std::shared_ptr<const SegmentCache::Segment> segment =
+      cache_.Lookup(request.url);
+  if (segment) {
+    hits_++;
+    size_t start = 0, end = 0;
+    if (!range.empty() && segment->content_range.empty()) {
+      std::string size = std::to_string(segment->body.size());
+      if (!ParseRange(range, segment->body.size(), &start, &end)) {
+        SendResponse(fd, is_head, 416, "", "bytes */" + size, nullptr, 0);
+        return;
+      }
+      std::string content_range = "bytes " + std::to_string(start) + "-" +
+                                  std::to_string(end) + "/" + size;
+      SendResponse(fd, is_head, 206, segment->content_type, content_range,
+                   segment->body.data() + start, end - start + 1);
+    } else {
+      SendResponse(fd, is_head, segment->content_range.empty() ? 200 : 206,
+                   segment->content_type, segment->content_range,
+                   segment->body.data(), segment->body.size());
+    }
+    SchedulePrefetch(request.url, prefetch_headers);
+    return;
+  }
+
+  std::string cache_key =
+      range.empty() ? request.url : request.url + "|" + range;
+  Response response;
+  bool from_cache = false;
+  if (!FetchSegment(request.url, cache_key, headers, &response,
+                    &from_cache)) {
+    SendError(fd, 502);
+    return;
+  }
+
+  if (response.status == 200 &&
+      IsHlsManifest(request.url, response.content_type)) {
+    std::string manifest =
+        RewriteHlsManifest(response.body, response.effective_url);
+    SendResponse(fd, is_head, 200, response.content_type, "", manifest.data(),
+                 manifest.size());
+    return;
+  }
+  if (response.status == 200 &&
+      IsDashManifest(request.url, response.content_type)) {
+    std::string manifest =
+        RewriteDashManifest(response.body, response.effective_url);
+    SendResponse(fd, is_head, 200, response.content_type, "", manifest.data(),
+                 manifest.size());
+    return;
+  }
+
+  if (from_cache) {
+    hits_++;
+  } else {
+    misses_++;
+  }
+  SendResponse(fd, is_head, response.status, response.content_type,
+               response.content_range, response.body.data(),
+               response.body.size());
+  if (response.status == 200 || response.status == 206) {
+    SchedulePrefetch(request.url, prefetch_headers);
+  }
+}
+
+bool SegmentCacheProxy::FetchSegment(const std::string &url,
+                                     const std::string &cache_key,
+                                     const Headers &headers,
+                                     Response *response, bool *from_cache) {
+  {
+    std::unique_lock<std::mutex> lock(fetch_mutex_);
+    fetch_cv_.wait(lock, [this, &cache_key] {
+      return in_flight_.find(cache_key) == in_flight_.end();
+    });
+    std::shared_ptr<const SegmentCache::Segment> segment =
+        cache_.Lookup(cache_key);
+    if (segment) {
+      response->status = segment->content_range.empty() ? 200 : 206;
+      response->content_type = segment->content_type;
+      response->content_range = segment->content_range;
+      response->effective_url = url;
+      response->body = segment->body;
+      if (from_cache) {
+        *from_cache = true;
+      }
+      return true;
+    }
+    in_flight_.insert(cache_key);
+  }
+
+  bool result = Fetch(url, headers, response);
+  if (result && (response->status == 200 || response->status == 206) &&
+      !IsHlsManifest(url, response->content_type) &&
+      !IsDashManifest(url, response->content_type)) {
+    auto segment = std::make_shared<SegmentCache::Segment>();
+    segment->content_type = response->content_type;
+    segment->content_range = response->content_range;
+    segment->body = response->body;
+    cache_.Store(cache_key, std::move(segment));
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(fetch_mutex_);
+    in_flight_.erase(cache_key);
+  }
+  fetch_cv_.notify_all();
+  return result;
+}
+
+bool SegmentCacheProxy::Fetch(const std::string &url, const Headers &headers,
+                              Response *response) {
+  CURL *curl = AcquireHandle();
+  if (!curl) {
+    LOG_ERROR("[SegmentCacheProxy] Fail to create a curl handle.");
+    return false;
+  }
+
+  curl_slist *header_list = nullptr;
+  for (const auto &[name, value] : headers) {
+    header_list =
+        curl_slist_append(header_list, (name + ": " + value).c_str());
+  }
+
+  curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+  curl_easy_setopt(curl, CURLOPT_HTTPHEADER, header_list);
+  curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+  curl_easy_setopt(curl, CURLOPT_MAXREDIRS, 5L);
+  curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+  curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, kConnectTimeoutSeconds);
+  curl_easy_setopt(curl, CURLOPT_LOW_SPEED_LIMIT, 1L);
+  curl_easy_setopt(curl, CURLOPT_LOW_SPEED_TIME, kLowSpeedTimeSeconds);
+  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteBody);
+  curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response->body);
+  curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, WriteHeader);
+  curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response->content_range);
+  curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+  curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, OnTransferProgress);
+  curl_easy_setopt(curl, CURLOPT_XFERINFODATA, &running_);
+
+  CURLcode result = curl_easy_perform(curl);
+  if (result == CURLE_OK) {
+    char *content_type = nullptr;
+    char *effective_url = nullptr;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response->status);
+    curl_easy_getinfo(curl, CURLINFO_CONTENT_TYPE, &content_type);
+    curl_easy_getinfo(curl, CURLINFO_EFFECTIVE_URL, &effective_url);
+    response->content_type = content_type ? content_type : "";
+    response->effective_url = effective_url ? effective_url : url;
+  } else if (running_) {
+    LOG_ERROR("[SegmentCacheProxy] Fail to fetch %s: %s", url.c_str(),
+              curl_easy_strerror(result));
+  }
+
+  curl_slist_free_all(header_list);
+  ReleaseHandle(curl);
+  return result == CURLE_OK;
+}
+
+void *SegmentCacheProxy::AcquireHandle() {
+  {
+    std::lock_guard<std::mutex> lock(handle_mutex_);
+    if (!idle_handles_.empty()) {
+      void *handle = idle_handles_.back();
+      idle_handles_.pop_back();
+      return handle;
+    }
+  }
+  return curl_easy_init();
+}
+
+void SegmentCacheProxy::ReleaseHandle(void *handle) {
+  // Keeps the live connections of the handle for the next request.
+  curl_easy_reset(handle);
+  std::lock_guard<std::mutex> lock(handle_mutex_);
+  if (!running_ || idle_handles_.size() >= kMaxIdleHandles) {
+    curl_easy_cleanup(handle);
+    return;
+  }
+  idle_handles_.push_back(handle);
+}
+
+std::string SegmentCacheProxy::RewriteHlsManifest(
+    const std::string &manifest, const std::string &manifest_url) {
+  std::istringstream stream(manifest);
+  std::ostringstream output;
+  std::vector<std::string> segments;
+  bool is_master_playlist = false;
+  std::string line;
+  while (std::getline(stream, line)) {
+    if (!line.empty() && line.back() == '\r') {
+      line.pop_back();
+    }
+    if (line.empty()) {
+    } else if (line[0] == '#') {
+      if (StartsWith(line, "#EXT-X-STREAM-INF") ||
+          StartsWith(line, "#EXT-X-I-FRAME-STREAM-INF") ||
+          StartsWith(line, "#EXT-X-MEDIA:")) {
+        is_master_playlist = true;
+      }
+      size_t uri_start = line.find("URI=\"");
+      if (uri_start != std::string::npos) {
+        uri_start += 5;
+        size_t uri_end = line.find('"', uri_start);
+        if (uri_end != std::string::npos) {
+          std::string uri = ResolveUrl(
+              manifest_url, line.substr(uri_start, uri_end - uri_start));
+          line.replace(uri_start, uri_end - uri_start, GetProxyUrl(uri));
+        }
+      }
+    } else {
+      std::string uri = ResolveUrl(manifest_url, line);
+      segments.push_back(uri);
+      line = GetProxyUrl(uri);
+    }
+    output << line << "\n";
+  }
+
+  if (!is_master_playlist && !segments.empty()) {
+    std::lock_guard<std::mutex> lock(manifest_mutex_);
+    std::vector<std::string> &playlist = hls_playlists_[manifest_url];
+    for (const std::string &segment : playlist) {
+      hls_segments_.erase(segment);
+    }
+    playlist = std::move(segments);
+    for (size_t i = 0; i < playlist.size(); i++) {
+      hls_segments_[playlist[i]] = {manifest_url, i};
+    }
+  }
+  return output.str();
+}
+
+std::string SegmentCacheProxy::RewriteDashManifest(
+    const std::string &manifest, const std::string &manifest_url) {
+  // Absolute URLs, and references starting with "/" which would otherwise
+  // resolve to the proxy itself rather than to the origin. Other relative
+  // references resolve to the proxy URL of the manifest and work as is.
+  static const std::regex kUrl(
+      "(<(?:BaseURL|Location)[^>]*>\\s*|"
+      "\\b(?:media|initialization|sourceURL)=\")"
+      "(https?://[^<\"\\s]+|/[^<\"\\s]*)");
+  static const std::regex kMediaTemplate(
+      "\\bmedia=\"([^\"]*\\$Number[^\"]*)\"");
+
+  for (std::sregex_iterator iter(manifest.begin(), manifest.end(),
+                                 kMediaTemplate);
+       iter != std::sregex_iterator(); ++iter) {
+    std::string media = (*iter)[1];
+    std::string pattern;
+    int number_width = 0;
+    if (!ParseNumberTemplate(media, &pattern, &number_width)) {
+      continue;
+    }
+    std::lock_guard<std::mutex> lock(manifest_mutex_);
+    if (number_templates_.find(pattern) == number_templates_.end()) {
+      number_templates_.emplace(
+          pattern, NumberTemplate{std::regex(pattern), number_width});
+    }
+  }
+
+  std::string output;
+  size_t last = 0;
+  for (std::sregex_iterator iter(manifest.begin(), manifest.end(),
+                                 kUrl);
+       iter != std::sregex_iterator(); ++iter) {
+    const std::smatch &match = *iter;
+    output.append(manifest, last, match.position(2) - last);
+    output += GetProxyUrl(ResolveUrl(manifest_url, match[2]));
+    last = match.position(2) + match.length(2);
+  }
+  output.append(manifest, last, std::string::npos);
+  return output;
+}
+
+void SegmentCacheProxy::SchedulePrefetch(const std::string &url,
+                                         const Headers &headers) {
+  if (prefetch_count_ <= 0) {
+    return;
+  }
+  std::vector<std::string> next_segments = GetNextSegments(url);
+  if (next_segments.empty()) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(prefetch_mutex_);
+  for (const std::string &segment : next_segments) {
+    if (cache_.Contains(segment)) {
+      continue;
+    }
+    auto queued = std::find_if(
+        prefetch_queue_.begin(), prefetch_queue_.end(),
+        [&segment](const auto &entry) { return entry.first == segment; });
+    if (queued == prefetch_queue_.end()) {
+      prefetch_queue_.emplace_back(segment, headers);
+    }
+  }
+  // Segments queued for an earlier position are no longer useful.
+  while (prefetch_queue_.size() > static_cast<size_t>(prefetch_count_)) {
+    prefetch_queue_.pop_front();
+  }
+  prefetch_cv_.notify_one();
+}
+
+std::vector<std::string> SegmentCacheProxy::GetNextSegments(
+    const std::string &url) {
+  std::vector<std::string> next_segments;
+  std::lock_guard<std::mutex> lock(manifest_mutex_);
+
+  auto segment = hls_segments_.find(url);
+  if (segment != hls_segments_.end()) {
+    const std::vector<std::string> &playlist =
+        hls_playlists_[segment->second.first];
+    size_t index = segment->second.second;
+    for (int i = 1; i <= prefetch_count_ && index + i < playlist.size(); i++) {
+      next_segments.push_back(playlist[index + i]);
+    }
+    return next_segments;
+  }
+
+  std::string path = StripQuery(url);
+  std::string query = url.substr(path.size());
+  for (const auto &[pattern, number_template] : number_templates_) {
+    std::smatch match;
+    if (!std::regex_search(path, match, number_template.pattern)) {
+      continue;
+    }
+    uint64_t number = 0;
+    if (!ParseNumber(match[1], &number)) {
+      continue;
+    }
+    size_t number_start = match.position(1);
+    size_t number_length = match.length(1);
+    for (int i = 1; i <= prefetch_count_; i++) {
+      std::string digits = std::to_string(number + i);
+      if (digits.size() < static_cast<size_t>(number_template.number_width)) {
+        digits.insert(0, number_template.number_width - digits.size(), '0');
+      }
+      next_segments.push_back(path.substr(0, number_start) + digits +
+                              path.substr(number_start + number_length) +
+                              query);
+    }
+    break;
+  }
+  return next_segments;
+}
+
+void SegmentCacheProxy::PrefetchLoop() {
+  while (true) {
+    std::pair<std::string, Headers> entry;
+    {
+      std::unique_lock<std::mutex> lock(prefetch_mutex_);
+      prefetch_cv_.wait(
+          lock, [this] { return !running_ || !prefetch_queue_.empty(); });
+      if (!running_) {
+        return;
+      }
+      entry = std::move(prefetch_queue_.front());
+      prefetch_queue_.pop_front();
+    }
+    if (cache_.Contains(entry.first)) {
+      continue;
+    }
+    Response response;
+    if (FetchSegment(entry.first, entry.first, entry.second, &response) &&
+        response.status == 200) {
+      prefetches_++;
+    }
+  }
+}
@@ -0,0 +1,158 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_SEGMENT_CACHE_PROXY_H_
+#define FLUTTER_PLUGIN_SEGMENT_CACHE_PROXY_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "segment_cache.h"
+
+// A caching HTTP proxy on the loopback interface for HLS and DASH streams.
+//
+// The player is given a proxy URL of the form
+// http://127.0.0.1:<port>/<scheme>/<host>/<path>, so that relative segment
+// URLs in manifests resolve to the proxy as well. Absolute and root-relative
+// URLs in manifests are rewritten to proxy URLs. Manifests are always fetched
+// from the origin, since live manifests change, while media segments are
+// served from a SegmentCache.
+//
+// The proxy learns the segment order from manifests (the segment list of HLS
+// media playlists and $Number$ based DASH segment templates) and, when a
+// segment is requested, prefetches the segments that follow it.
+class SegmentCacheProxy {
+ public:
+  struct Statistics {
+    int64_t hits = 0;
+    int64_t misses = 0;
+    int64_t prefetches = 0;
+    int64_t evictions = 0;
+    size_t cached_size = 0;
+  };
+
+  SegmentCacheProxy(size_t max_cache_size, int prefetch_count);
+  ~SegmentCacheProxy();
+
+  SegmentCacheProxy(const SegmentCacheProxy &) = delete;
+  SegmentCacheProxy &operator=(const SegmentCacheProxy &) = delete;
+
+  // Starts listening on an ephemeral port. Returns false on failure.
+  bool Start();
+  void Stop();
+
+  // Returns the URL that fetches |url| through the proxy, or |url| itself if
+  // the proxy is not running or |url| is not an HTTP(S) URL. The proxy only
+  // serves requests for the origins (scheme, host and port) of URLs returned
+  // by this method, and answers others with 403.
+  std::string GetProxyUrl(const std::string &url);
+
+  Statistics GetStatistics();
+
+ private:
+  using Headers = std::map<std::string, std::string>;
+
+  struct Request {
+    std::string method;
+    std::string url;
+    Headers headers;
+  };
+
+  struct Response {
+    long status = 0;
+    std::string content_type;
+    std::string content_range;
+    std::string effective_url;
+    std::string body;
+  };
+
+  // A $Number$ based DASH segment template, matched against the path of
+  // requested segment URLs.
+  struct NumberTemplate {
+    std::regex pattern;
+    int number_width;
+  };
+
+  void AcceptLoop();
+  void HandleConnection(int fd);
+  void HandleRequest(int fd, const Request &request);
+
+  // Fetches |url| from the origin, or waits for the download of |url| if it
+  // is already in progress. Media segments are stored in the cache.
+  // |cache_key| is the key under which the response is stored. If
+  // |from_cache| is given, it is set to true when the response was served
+  // from the cache after waiting for the download in progress.
+  bool FetchSegment(const std::string &url, const std::string &cache_key,
+                    const Headers &headers, Response *response,
+                    bool *from_cache = nullptr);
+  bool Fetch(const std::string &url, const Headers &headers,
+             Response *response);
+  void *AcquireHandle();
+  void ReleaseHandle(void *handle);
+
+  std::string RewriteHlsManifest(const std::string &manifest,
+                                 const std::string &manifest_url);
+  std::string RewriteDashManifest(const std::string &manifest,
+                                  const std::string &manifest_url);
+
+  void SchedulePrefetch(const std::string &url, const Headers &headers);
+  std::vector<std::string> GetNextSegments(const std::string &url);
+  void PrefetchLoop();
+
+  int prefetch_count_;
+  SegmentCache cache_;
+
+  int listen_fd_ = -1;
+  int port_ = 0;
+  std::atomic<bool> running_{false};
+  std::thread accept_thread_;
+
+  // Origins of the URLs handed out by GetProxyUrl().
+  std::mutex origin_mutex_;
+  std::set<std::string> allowed_origins_;
+
+  // Open client connections, closed on Stop().
+  std::mutex connection_mutex_;
+  std::condition_variable connection_cv_;
+  std::set<int> connection_fds_;
+  int active_connections_ = 0;
+
+  // Segment order learned from manifests. Segments are mapped to the HLS
+  // playlist they were last listed in and their index in that playlist.
+  std::mutex manifest_mutex_;
+  std::map<std::string, std::vector<std::string>> hls_playlists_;
+  std::map<std::string, std::pair<std::string, size_t>> hls_segments_;
+  std::map<std::string, NumberTemplate> number_templates_;
+
+  // Idle curl handles, kept to reuse connections to the origin.
+  std::mutex handle_mutex_;
+  std::vector<void *> idle_handles_;
+
+  // Segments being downloaded, so that a request for a segment that is being
+  // prefetched waits for it instead of downloading it again.
+  std::mutex fetch_mutex_;
+  std::condition_variable fetch_cv_;
+  std::set<std::string> in_flight_;
+
+  std::mutex prefetch_mutex_;
+  std::condition_variable prefetch_cv_;
+  std::deque<std::pair<std::string, Headers>> prefetch_queue_;
+  std::thread prefetch_thread_;
+
+  std::atomic<int64_t> hits_{0};
+  std::atomic<int64_t> misses_{0};
+  std::atomic<int64_t> prefetches_{0};
+};
+
+#endif  // FLUTTER_PLUGIN_SEGMENT_CACHE_PROXY_H_
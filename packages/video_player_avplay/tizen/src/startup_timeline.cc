@@ -0,0 +1,84 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "startup_timeline.h"
+
+#include <chrono>
+
+#include "log.h"
+
+namespace {
+
+constexpr int64_t kNotReached = -1;
+
+const char *const kStageNames[StartupTimeline::kStageCount] = {
+    "opened",           "drmSessionCreated", "licenseRequested",
+    "licenseReceived",  "licenseInstalled",  "prepareStarted",
+    "prepared",         "initialized",       "playing",
+};
+
+int64_t NowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+StartupTimeline::StartupTimeline() {
+  for (std::atomic<int64_t> &time : stage_times_us_) {
+    time = kNotReached;
+  }
+}
+
+void StartupTimeline::Start(bool log_summary) {
+  for (std::atomic<int64_t> &time : stage_times_us_) {
+    time = kNotReached;
+  }
+  log_summary_ = log_summary;
+  start_time_us_ = NowUs();
+}
+
+void StartupTimeline::Mark(Stage stage) {
+  int64_t start_time = start_time_us_;
+  if (start_time == kNotReached) {
+    return;
+  }
+  int64_t expected = kNotReached;
+  if (!stage_times_us_[stage].compare_exchange_strong(expected,
+                                                      NowUs() - start_time)) {
+    return;
+  }
+  if (stage == kPlaying && log_summary_) {
+    LOG_INFO("[StartupTimeline] %s", Summary().c_str());
+  }
+}
+
+flutter::EncodableMap StartupTimeline::ToEncodableMap() const {
+  flutter::EncodableMap map;
+  for (int stage = 0; stage < kStageCount; stage++) {
+    int64_t time = stage_times_us_[stage];
+    if (time != kNotReached) {
+      map[flutter::EncodableValue(kStageNames[stage])] =
+          flutter::EncodableValue(time);
+    }
+  }
+  return map;
+}
+
+std::string StartupTimeline::Summary() const {
+  std::string summary;
+  for (int stage = 0; stage < kStageCount; stage++) {
+    int64_t time = stage_times_us_[stage];
+    if (time == kNotReached) {
+      continue;
+    }
+    if (!summary.empty()) {
+      summary += ", ";
+    }
+    summary += std::string(kStageNames[stage]) + ": " +
+               std::to_string(time / 1000) + " ms";
+  }
+  return summary;
+}
@@ -0,0 +1,54 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_STARTUP_TIMELINE_H_
+#define FLUTTER_PLUGIN_STARTUP_TIMELINE_H_
+
+#include <flutter/encodable_value.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Records when each stage of a player start-up is reached, relative to the
+// creation of the player, using a monotonic clock.
+//
+// Stages may be marked from any thread. Only the first occurrence of a stage
+// after Start() is recorded.
+class StartupTimeline {
+ public:
+  enum Stage {
+    kOpened,
+    kDrmSessionCreated,
+    kLicenseRequested,
+    kLicenseReceived,
+    kLicenseInstalled,
+    kPrepareStarted,
+    kPrepared,
+    kInitialized,
+    kPlaying,
+    kStageCount,
+  };
+
+  StartupTimeline();
+
+  // Clears all stages and starts measuring from now. If |log_summary| is
+  // true, a summary is logged when kPlaying is reached.
+  void Start(bool log_summary);
+  void Mark(Stage stage);
+
+  // Returns a map from the names of the reached stages to the elapsed time
+  // in microseconds.
+  flutter::EncodableMap ToEncodableMap() const;
+
+ private:
+  std::string Summary() const;
+
+  std::atomic<int64_t> start_time_us_{-1};
+  std::array<std::atomic<int64_t>, kStageCount> stage_times_us_;
+  std::atomic<bool> log_summary_{false};
+};
+
+#endif  // FLUTTER_PLUGIN_STARTUP_TIMELINE_H_
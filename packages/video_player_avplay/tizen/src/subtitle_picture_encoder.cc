@@ -0,0 +1,175 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "subtitle_picture_encoder.h"
+
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <mutex>
+
+#include "log.h"
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+
+namespace video_player_avplay_tizen {
+
+namespace {
+
+// The number of encoded pictures kept for reuse.
+constexpr size_t kMaxCachedPictures = 8;
+
+// The number of pictures waiting to be encoded. Cues arrive seconds apart,
+// so the queue only fills up if the worker is starved, in which case the
+// oldest picture has most likely been superseded on screen already.
+constexpr size_t kMaxPendingPictures = 8;
+
+// Subtitle bitmaps consist of large flat areas. Skipping the per-row filter
+// search and using a lighter compression level halves the encoding time
+// without making the output larger.
+constexpr int kPngCompressionLevel = 5;
+constexpr int kPngFilterNone = 0;
+
+// The nice value of the worker thread, so that encoding does not compete
+// with the media pipeline for CPU time.
+constexpr int kWorkerNiceValue = 10;
+
+uint64_t HashPicture(const std::vector<unsigned char> &pixels, int width,
+                     int height, int channels) {
+  // FNV-1a over 64-bit words.
+  constexpr uint64_t kPrime = 0x100000001b3ULL;
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  auto mix = [&hash](uint64_t value) {
+    hash ^= value;
+    hash *= kPrime;
+  };
+  mix(static_cast<uint64_t>(width));
+  mix(static_cast<uint64_t>(height));
+  mix(static_cast<uint64_t>(channels));
+
+  size_t size = pixels.size();
+  size_t offset = 0;
+  for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, pixels.data() + offset, sizeof(word));
+    mix(word);
+  }
+  for (; offset < size; offset++) {
+    mix(pixels[offset]);
+  }
+  return hash;
+}
+
+}  // namespace
+
+SubtitlePictureEncoder::SubtitlePictureEncoder(EncodedCallback callback)
+    : callback_(std::move(callback)) {
+  static std::once_flag png_options_flag;
+  std::call_once(png_options_flag, [] {
+    stbi_write_png_compression_level = kPngCompressionLevel;
+    stbi_write_force_png_filter = kPngFilterNone;
+  });
+  worker_ = std::thread(&SubtitlePictureEncoder::Run, this);
+}
+
+SubtitlePictureEncoder::~SubtitlePictureEncoder() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  cv_.notify_one();
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+}
+
+void SubtitlePictureEncoder::Encode(const unsigned char *data, int width,
+                                    int height, int channels,
+                                    uint64_t duration, int64_t sequence) {
+  auto picture = std::make_unique<Picture>();
+  picture->pixels.assign(data, data + static_cast<size_t>(width) * height *
+                                          channels);
+  picture->width = width;
+  picture->height = height;
+  picture->channels = channels;
+  picture->duration = duration;
+  picture->sequence = sequence;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pending_.size() >= kMaxPendingPictures) {
+      LOG_INFO("[SubtitlePictureEncoder] Drop the oldest picture not encoded.");
+      pending_.pop_front();
+    }
+    pending_.push_back(std::move(picture));
+  }
+  cv_.notify_one();
+}
+
+void SubtitlePictureEncoder::Run() {
+  if (setpriority(PRIO_PROCESS, syscall(SYS_gettid), kWorkerNiceValue) != 0) {
+    LOG_WARN("[SubtitlePictureEncoder] Fail to lower the thread priority.");
+  }
+
+  while (true) {
+    std::unique_ptr<Picture> picture;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this] { return stopped_ || !pending_.empty(); });
+      if (stopped_) {
+        return;
+      }
+      picture = std::move(pending_.front());
+      pending_.pop_front();
+    }
+
+    std::shared_ptr<const std::vector<uint8_t>> png = GetPng(*picture);
+    if (png) {
+      callback_(picture->sequence, picture->duration, *png, picture->width,
+                picture->height);
+    }
+  }
+}
+
+std::shared_ptr<const std::vector<uint8_t>> SubtitlePictureEncoder::GetPng(
+    const Picture &picture) {
+  uint64_t hash = HashPicture(picture.pixels, picture.width, picture.height,
+                              picture.channels);
+  for (auto iter = cache_.begin(); iter != cache_.end(); ++iter) {
+    if (iter->hash == hash && iter->width == picture.width &&
+        iter->height == picture.height &&
+        iter->channels == picture.channels &&
+        iter->pixels == picture.pixels) {
+      cache_.splice(cache_.begin(), cache_, iter);
+      return cache_.front().png;
+    }
+  }
+
+  int length = 0;
+  unsigned char *encoded = stbi_write_png_to_mem(
+      picture.pixels.data(), picture.width * picture.channels, picture.width,
+      picture.height, picture.channels, &length);
+  if (!encoded || length <= 0) {
+    LOG_ERROR("[SubtitlePictureEncoder] Fail to encode the picture.");
+    if (encoded) {
+      STBIW_FREE(encoded);
+    }
+    return nullptr;
+  }
+  auto png = std::make_shared<const std::vector<uint8_t>>(encoded,
+                                                          encoded + length);
+  STBIW_FREE(encoded);
+
+  cache_.push_front({hash, picture.pixels, picture.width, picture.height,
+                     picture.channels, png});
+  if (cache_.size() > kMaxCachedPictures) {
+    cache_.pop_back();
+  }
+  return png;
+}
+
+}  // namespace video_player_avplay_tizen
@@ -0,0 +1,79 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_SUBTITLE_PICTURE_ENCODER_H_
+#define FLUTTER_PLUGIN_SUBTITLE_PICTURE_ENCODER_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace video_player_avplay_tizen {
+
+// Encodes picture subtitles (e.g. DVB and PGS) to PNG on a low priority
+// worker thread so that the player callback thread is not blocked.
+//
+// Pictures are encoded in the order they are queued, and each carries the
+// sequence number of its subtitle update so that the receiver can discard a
+// picture superseded by a later cue. Recently encoded pictures are cached by
+// content, since the same bitmap is often delivered repeatedly.
+class SubtitlePictureEncoder {
+ public:
+  using EncodedCallback = std::function<void(
+      int64_t sequence, uint64_t duration, const std::vector<uint8_t> &png,
+      double width, double height)>;
+
+  explicit SubtitlePictureEncoder(EncodedCallback callback);
+  ~SubtitlePictureEncoder();
+
+  SubtitlePictureEncoder(const SubtitlePictureEncoder &) = delete;
+  SubtitlePictureEncoder &operator=(const SubtitlePictureEncoder &) = delete;
+
+  // Copies |data| and queues it for encoding. The callback is invoked on the
+  // worker thread.
+  void Encode(const unsigned char *data, int width, int height, int channels,
+              uint64_t duration, int64_t sequence);
+
+ private:
+  struct Picture {
+    std::vector<unsigned char> pixels;
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    uint64_t duration = 0;
+    int64_t sequence = 0;
+  };
+
+  struct CacheEntry {
+    uint64_t hash;
+    // The source picture, compared on a hash match to rule out collisions.
+    std::vector<unsigned char> pixels;
+    int width;
+    int height;
+    int channels;
+    std::shared_ptr<const std::vector<uint8_t>> png;
+  };
+
+  void Run();
+  std::shared_ptr<const std::vector<uint8_t>> GetPng(const Picture &picture);
+
+  EncodedCallback callback_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::unique_ptr<Picture>> pending_;
+  bool stopped_ = false;
+  std::thread worker_;
+  // Accessed only on the worker thread, most recently used first.
+  std::list<CacheEntry> cache_;
+};
+
+}  // namespace video_player_avplay_tizen
+
+#endif  // FLUTTER_PLUGIN_SUBTITLE_PICTURE_ENCODER_H_
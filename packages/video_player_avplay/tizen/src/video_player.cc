@@ -13,6 +13,10 @@ namespace video_player_avplay_tizen {
 
 static int64_t player_index = 1;
 
+// The position clock drifts from the player over time (e.g. due to dropped
+// frames), so it is corrected by sampling the player at this interval.
+constexpr int64_t kMaxPositionSampleAge = 2000;
+
 VideoPlayer::VideoPlayer(flutter::BinaryMessenger *messenger,
                          FlutterDesktopViewRef flutter_view)
     : ecore_wl2_window_proxy_(std::make_unique<EcoreWl2WindowProxy>()),
@@ -27,6 +31,7 @@ VideoPlayer::VideoPlayer(flutter::BinaryMessenger *messenger,
 }
 
 VideoPlayer::~VideoPlayer() {
+  StopPositionUpdates();
   if (sink_event_pipe_) {
     ecore_pipe_del(sink_event_pipe_);
     sink_event_pipe_ = nullptr;
@@ -34,6 +39,7 @@ VideoPlayer::~VideoPlayer() {
 }
 
 void VideoPlayer::ClearUpEventChannel() {
+  StopPositionUpdates();
   is_initialized_ = false;
   event_sink_ = nullptr;
   if (event_channel_) {
@@ -105,6 +111,7 @@ void VideoPlayer::SendInitialized() {
     int32_t width = 0, height = 0;
     GetVideoSize(&width, &height);
     is_initialized_ = true;
+    startup_timeline_.Mark(StartupTimeline::kInitialized);
     auto duration = GetDuration();
     flutter::EncodableList duration_range{
         flutter::EncodableValue(duration.first),
@@ -123,6 +130,7 @@ void VideoPlayer::SendInitialized() {
 }
 
 void VideoPlayer::SendBufferingStart() {
+  position_clock_.SetBuffering(true);
   flutter::EncodableMap result = {
       {flutter::EncodableValue("event"),
        flutter::EncodableValue("bufferingStart")},
@@ -140,6 +148,7 @@ void VideoPlayer::SendBufferingUpdate(int32_t value) {
 }
 
 void VideoPlayer::SendBufferingEnd() {
+  position_clock_.SetBuffering(false);
   flutter::EncodableMap result = {
       {flutter::EncodableValue("event"),
        flutter::EncodableValue("bufferingEnd")},
@@ -149,7 +158,11 @@ void VideoPlayer::SendBufferingEnd() {
 
 void VideoPlayer::SendSubtitleUpdate(int32_t duration,
                                      flutter::EncodableList texts_info,
-                                     flutter::EncodableMap picture_info) {
+                                     flutter::EncodableMap picture_info,
+                                     int64_t sequence) {
+  if (sequence < 0) {
+    sequence = NextSubtitleSequence();
+  }
   flutter::EncodableMap result = {
       {flutter::EncodableValue("event"),
        flutter::EncodableValue("subtitleUpdate")},
@@ -158,12 +171,14 @@ void VideoPlayer::SendSubtitleUpdate(int32_t duration,
        flutter::EncodableValue(texts_info)},
       {flutter::EncodableValue("pictureInfo"),
        flutter::EncodableValue(picture_info)},
+      {flutter::EncodableValue("sequence"), flutter::EncodableValue(sequence)},
   };
 
   PushEvent(flutter::EncodableValue(result));
 }
 
 void VideoPlayer::SendPlayCompleted() {
+  position_clock_.SetPlaying(false);
   flutter::EncodableMap result = {
       {flutter::EncodableValue("event"), flutter::EncodableValue("completed")},
   };
@@ -171,6 +186,7 @@ void VideoPlayer::SendPlayCompleted() {
 }
 
 void VideoPlayer::SendIsPlayingState(bool is_playing) {
+  position_clock_.SetPlaying(is_playing);
   flutter::EncodableMap result = {
       {flutter::EncodableValue("event"),
        flutter::EncodableValue("isPlayingStateUpdate")},
@@ -183,6 +199,7 @@ void VideoPlayer::SendIsPlayingState(bool is_playing) {
 void VideoPlayer::SendRestored() {
   if (is_restored_ && event_sink_) {
     is_restored_ = false;
+    position_clock_.Invalidate();
     int32_t width = 0, height = 0;
     GetVideoSize(&width, &height);
     auto duration = GetDuration();
@@ -228,6 +245,60 @@ void VideoPlayer::SendError(const std::string &error_code,
   }
 }
 
+void VideoPlayer::SendPositionUpdate() {
+  if (!is_initialized_ || !event_sink_) {
+    return;
+  }
+  if (position_clock_.NeedsSample(kMaxPositionSampleAge)) {
+    position_clock_.Sample(GetPosition());
+  } else if (!position_clock_.IsAdvancing()) {
+    return;
+  }
+
+  flutter::EncodableMap result = {
+      {flutter::EncodableValue("event"),
+       flutter::EncodableValue("positionUpdate")},
+      {flutter::EncodableValue("position"),
+       flutter::EncodableValue(position_clock_.GetPosition())},
+  };
+  PushEvent(flutter::EncodableValue(result));
+}
+
+void VideoPlayer::StartPositionUpdates(int64_t interval_ms) {
+  StopPositionUpdates();
+  if (interval_ms <= 0) {
+    return;
+  }
+  position_update_interval_ = interval_ms;
+  position_update_timer_ = ecore_timer_add(
+      interval_ms / 1000.0,
+      [](void *data) -> Eina_Bool {
+        auto *self = static_cast<VideoPlayer *>(data);
+        self->SendPositionUpdate();
+        return ECORE_CALLBACK_RENEW;
+      },
+      this);
+  if (!position_update_timer_) {
+    LOG_ERROR("[VideoPlayer] Fail to add the position update timer.");
+  }
+}
+
+void VideoPlayer::StopPositionUpdates() {
+  if (position_update_timer_) {
+    ecore_timer_del(position_update_timer_);
+    position_update_timer_ = nullptr;
+  }
+}
+
+int64_t VideoPlayer::GetEstimatedPosition() {
+  int64_t position = position_clock_.GetPosition();
+  if (position < 0) {
+    position = GetPosition();
+    position_clock_.Sample(position);
+  }
+  return position;
+}
+
 void *VideoPlayer::GetWindowHandle() {
   return FlutterDesktopViewGetNativeHandle(flutter_view_);
 }
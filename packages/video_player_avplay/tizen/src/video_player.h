@@ -10,6 +10,7 @@
 #include <flutter/event_channel.h>
 #include <flutter_tizen.h>
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -18,6 +19,8 @@
 
 #include "ecore_wl2_window_proxy.h"
 #include "messages.h"
+#include "position_clock.h"
+#include "startup_timeline.h"
 
 namespace video_player_avplay_tizen {
 
@@ -72,6 +75,15 @@ class VideoPlayer {
   virtual flutter::EncodableList GetActiveTrackInfo() {
     return flutter::EncodableList{};
   }
+  virtual flutter::EncodableMap GetAbrTelemetry() {
+    return flutter::EncodableMap{};
+  }
+  flutter::EncodableMap GetStartupReport() const {
+    return startup_timeline_.ToEncodableMap();
+  }
+  // Returns the position estimated by the position clock. The player is only
+  // queried if it has never been sampled.
+  int64_t GetEstimatedPosition();
 
  protected:
   virtual void GetVideoSize(int32_t *width, int32_t *height) = 0;
@@ -82,9 +94,15 @@ class VideoPlayer {
   void SendBufferingStart();
   void SendBufferingUpdate(int32_t value);
   void SendBufferingEnd();
+  // Subtitle updates carry an increasing sequence number so that an update
+  // delivered late (e.g. a picture encoded asynchronously) can be discarded
+  // when a later one has already been shown. A negative |sequence| takes the
+  // next number.
   void SendSubtitleUpdate(
       int32_t duration, flutter::EncodableList texts_info,
-      flutter::EncodableMap picture_info = flutter::EncodableMap{});
+      flutter::EncodableMap picture_info = flutter::EncodableMap{},
+      int64_t sequence = -1);
+  int64_t NextSubtitleSequence() { return subtitle_sequence_++; }
   void SendPlayCompleted();
   void SendIsPlayingState(bool is_playing);
   void SendRestored();
@@ -92,6 +110,16 @@ class VideoPlayer {
   void SendManifestInfo(std::string manifest_info);
   void SendError(const std::string &error_code,
                  const std::string &error_message);
+  // Starts pushing positionUpdate events every |interval_ms| milliseconds
+  // while the position is advancing. Does nothing if |interval_ms| is not
+  // positive.
+  void StartPositionUpdates(int64_t interval_ms);
+  void StopPositionUpdates();
+  // Restarts position updates stopped by StopPositionUpdates() with the last
+  // interval.
+  void ResumePositionUpdates() {
+    StartPositionUpdates(position_update_interval_);
+  }
 
   std::mutex queue_mutex_;
   std::unique_ptr<EcoreWl2WindowProxy> ecore_wl2_window_proxy_ = nullptr;
@@ -99,10 +127,13 @@ class VideoPlayer {
   bool is_initialized_ = false;
   FlutterDesktopViewRef flutter_view_;
   bool is_restored_ = false;
+  StartupTimeline startup_timeline_;
+  PositionClock position_clock_;
 
  private:
   void ExecuteSinkEvents();
   void PushEvent(flutter::EncodableValue encodable_value);
+  void SendPositionUpdate();
 
   std::queue<flutter::EncodableValue> encodable_event_queue_;
   std::queue<std::pair<std::string, std::string>> error_event_queue_;
@@ -110,6 +141,9 @@ class VideoPlayer {
       event_channel_;
   std::unique_ptr<flutter::EventSink<flutter::EncodableValue>> event_sink_;
   Ecore_Pipe *sink_event_pipe_ = nullptr;
+  Ecore_Timer *position_update_timer_ = nullptr;
+  std::atomic<int64_t> subtitle_sequence_{0};
+  int64_t position_update_interval_ = 0;
 };
 
 }  // namespace video_player_avplay_tizen
@@ -130,6 +164,26 @@ inline const T GetValue(const flutter::EncodableMap *map,
   return std::move(default_value);
 }
 
+// Integers that fit in 32 bits are encoded as int32_t by the standard codec,
+// so both integer types are accepted.
+inline int64_t GetIntegerValue(const flutter::EncodableMap *map,
+                               const std::string &key, int64_t default_value) {
+  if (map == nullptr) {
+    return default_value;
+  }
+  auto it = map->find(flutter::EncodableValue(key));
+  if (it == map->end()) {
+    return default_value;
+  }
+  if (std::holds_alternative<int32_t>(it->second)) {
+    return std::get<int32_t>(it->second);
+  }
+  if (std::holds_alternative<int64_t>(it->second)) {
+    return std::get<int64_t>(it->second);
+  }
+  return default_value;
+}
+
 }  // namespace flutter_common
 
 #endif  // FLUTTER_PLUGIN_VIDEO_PLAYER_H_
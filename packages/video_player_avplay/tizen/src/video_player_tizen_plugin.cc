@@ -10,18 +10,44 @@
 #include <flutter_tizen.h>
 
 #include <cstdint>
+#include <deque>
 #include <map>
 #include <optional>
 #include <string>
 #include <variant>
 
+#include "drm_manager.h"
 #include "media_player.h"
 #include "messages.h"
+#include "player_preloader.h"
 #include "plus_player.h"
+#include "segment_cache_proxy.h"
 #include "video_player_options.h"
 
 namespace video_player_avplay_tizen {
 
+// Enough to keep both neighbours of the current channel prepared.
+constexpr size_t kMaxPreloadedPlayers = 2;
+
+constexpr int64_t kDefaultSegmentCacheSize = 64 * 1024 * 1024;
+constexpr int64_t kDefaultSegmentPrefetchCount = 2;
+
+// Returns the options of |msg| that a preloaded player must have been created
+// with to be used for |msg|.
+static flutter::EncodableValue GetPreloadOptions(const CreateMessage &msg) {
+  auto to_value = [](const flutter::EncodableMap *map) {
+    return map ? flutter::EncodableValue(*map) : flutter::EncodableValue();
+  };
+  return flutter::EncodableValue(flutter::EncodableList{
+      msg.format_hint() ? flutter::EncodableValue(*msg.format_hint())
+                        : flutter::EncodableValue(),
+      to_value(msg.http_headers()),
+      to_value(msg.drm_configs()),
+      to_value(msg.player_options()),
+      to_value(msg.streaming_property()),
+  });
+}
+
 class VideoPlayerTizenPlugin : public flutter::Plugin,
                                public VideoPlayerAvplayApi {
  public:
@@ -69,6 +95,14 @@ class VideoPlayerTizenPlugin : public flutter::Plugin,
   ErrorOr<bool> UpdateDashToken(int64_t player_id,
                                 const std::string &dashToken) override;
   ErrorOr<TrackMessage> GetActiveTrackInfo(const PlayerMessage &msg) override;
+  ErrorOr<bool> PrefetchLicense(const std::string &uri, int64_t drm_type,
+                                const std::string &license_server_url,
+                                int64_t license_cache_max_age) override;
+  ErrorOr<bool> Preload(const CreateMessage &msg) override;
+  std::optional<FlutterError> ReleasePreloadedPlayers() override;
+  ErrorOr<flutter::EncodableMap> GetStartupReport(int64_t player_id) override;
+  ErrorOr<PositionMessage> EstimatedPosition(const PlayerMessage &msg) override;
+  ErrorOr<flutter::EncodableMap> GetAbrTelemetry(int64_t player_id) override;
 
   std::optional<FlutterError> Suspend(int64_t player_id) override;
   std::optional<FlutterError> Restore(int64_t palyer_id,
@@ -85,12 +119,20 @@ class VideoPlayerTizenPlugin : public flutter::Plugin,
 
  private:
   void DisposeAllPlayers();
+  void ReleaseLicensePrefetchers(size_t max_count);
+  std::string GetPlaybackUri(const std::string &uri, const CreateMessage &msg);
 
   FlutterDesktopPluginRegistrarRef registrar_ref_;
   flutter::PluginRegistrar *plugin_registrar_;
   VideoPlayerOptions options_;
 
   static inline std::map<int64_t, std::unique_ptr<VideoPlayer>> players_;
+  // DRM sessions acquiring licenses ahead of playback, oldest first.
+  std::deque<std::unique_ptr<DrmManager>> license_prefetchers_;
+  PlayerPreloader player_preloader_{kMaxPreloadedPlayers};
+  // Shared by all players that enable the segmentCache option. Configured by
+  // the first of them.
+  std::unique_ptr<SegmentCacheProxy> segment_cache_proxy_;
 };
 
 void VideoPlayerTizenPlugin::RegisterWithRegistrar(
@@ -115,6 +157,51 @@ void VideoPlayerTizenPlugin::DisposeAllPlayers() {
     player->Dispose();
   }
   players_.clear();
+  ReleaseLicensePrefetchers(0);
+  player_preloader_.Clear();
+  segment_cache_proxy_.reset();
+}
+
+void VideoPlayerTizenPlugin::ReleaseLicensePrefetchers(size_t max_count) {
+  while (license_prefetchers_.size() > max_count) {
+    license_prefetchers_.front()->StopDrmSession();
+    license_prefetchers_.pop_front();
+  }
+}
+
+std::string VideoPlayerTizenPlugin::GetPlaybackUri(const std::string &uri,
+                                                   const CreateMessage &msg) {
+  const flutter::EncodableMap *player_options = msg.player_options();
+  if (!flutter_common::GetValue(player_options, "segmentCache", false)) {
+    return uri;
+  }
+  // Only adaptive streams are cached, since the proxy buffers whole
+  // responses.
+  std::string format = msg.format_hint() ? *msg.format_hint() : "";
+  std::string path = uri.substr(0, uri.find_first_of("?#"));
+  auto ends_with = [&path](const std::string &suffix) {
+    return path.size() >= suffix.size() &&
+           path.compare(path.size() - suffix.size(), suffix.size(), suffix) ==
+               0;
+  };
+  if (format != "hls" && format != "dash" && !ends_with(".m3u8") &&
+      !ends_with(".mpd")) {
+    return uri;
+  }
+
+  if (!segment_cache_proxy_) {
+    int64_t cache_size = flutter_common::GetIntegerValue(
+        player_options, "segmentCacheSize", kDefaultSegmentCacheSize);
+    int64_t prefetch_count = flutter_common::GetIntegerValue(
+        player_options, "segmentPrefetchCount", kDefaultSegmentPrefetchCount);
+    auto proxy = std::make_unique<SegmentCacheProxy>(
+        static_cast<size_t>(cache_size), static_cast<int>(prefetch_count));
+    if (!proxy->Start()) {
+      return uri;
+    }
+    segment_cache_proxy_ = std::move(proxy);
+  }
+  return segment_cache_proxy_->GetProxyUrl(uri);
 }
 
 std::optional<FlutterError> VideoPlayerTizenPlugin::Initialize() {
@@ -143,6 +230,22 @@ ErrorOr<PlayerMessage> VideoPlayerTizenPlugin::Create(
     return FlutterError("Invalid argument", "Either asset or uri must be set.");
   }
 
+  int64_t preloaded_player_id = -1;
+  std::unique_ptr<VideoPlayer> preloaded_player = player_preloader_.Take(
+      uri, GetPreloadOptions(msg), &preloaded_player_id);
+  if (preloaded_player) {
+    // Tracks can be activated only after preparation. The player has not
+    // acquired a decoder yet, so activation also fails if another player
+    // still holds it. In either case, open the source again.
+    if (preloaded_player->IsReady() && preloaded_player->Activate()) {
+      players_[preloaded_player_id] = std::move(preloaded_player);
+      PlayerMessage result(preloaded_player_id);
+      return result;
+    }
+    preloaded_player->Dispose();
+    preloaded_player.reset();
+  }
+
   std::unique_ptr<VideoPlayer> player = nullptr;
   if (uri.substr(0, 4) == "http") {
     player = std::make_unique<PlusPlayer>(
@@ -153,7 +256,7 @@ ErrorOr<PlayerMessage> VideoPlayerTizenPlugin::Create(
         plugin_registrar_->messenger(),
         FlutterDesktopPluginRegistrarGetView(registrar_ref_));
   }
-  int64_t player_id = player->Create(uri, msg);
+  int64_t player_id = player->Create(GetPlaybackUri(uri, msg), msg);
   if (player_id == -1) {
     return FlutterError("Operation failed", "Failed to create a player.");
   }
@@ -428,6 +531,90 @@ ErrorOr<TrackMessage> VideoPlayerTizenPlugin::GetActiveTrackInfo(
   return result;
 }
 
+ErrorOr<bool> VideoPlayerTizenPlugin::PrefetchLicense(
+    const std::string &uri, int64_t drm_type,
+    const std::string &license_server_url, int64_t license_cache_max_age) {
+  // Each prefetch holds a DRM session until it is replaced by a newer one.
+  constexpr size_t kMaxLicensePrefetchers = 4;
+
+  auto drm_manager = std::make_unique<DrmManager>();
+  if (!drm_manager->PrefetchLicense(uri, drm_type, license_server_url,
+                                    license_cache_max_age)) {
+    return false;
+  }
+  ReleaseLicensePrefetchers(kMaxLicensePrefetchers - 1);
+  license_prefetchers_.push_back(std::move(drm_manager));
+  return true;
+}
+
+ErrorOr<bool> VideoPlayerTizenPlugin::Preload(const CreateMessage &msg) {
+  if (!FlutterDesktopPluginRegistrarGetView(registrar_ref_)) {
+    return FlutterError("Operation failed", "Could not get a Flutter view.");
+  }
+  // Only network sources played by PlusPlayer support prebuffer mode.
+  if (!msg.uri() || msg.uri()->substr(0, 4) != "http") {
+    return false;
+  }
+  const std::string &uri = *msg.uri();
+  flutter::EncodableValue options = GetPreloadOptions(msg);
+  if (player_preloader_.Contains(uri, options)) {
+    return true;
+  }
+
+  flutter::EncodableMap player_options;
+  if (msg.player_options()) {
+    player_options = *msg.player_options();
+  }
+  player_options[flutter::EncodableValue("prebufferMode")] =
+      flutter::EncodableValue(true);
+  CreateMessage preload_msg = msg;
+  preload_msg.set_player_options(player_options);
+
+  auto player = std::make_unique<PlusPlayer>(
+      plugin_registrar_->messenger(),
+      FlutterDesktopPluginRegistrarGetView(registrar_ref_));
+  int64_t player_id =
+      player->Create(GetPlaybackUri(uri, preload_msg), preload_msg);
+  if (player_id == -1) {
+    return false;
+  }
+  player_preloader_.Add(uri, options, player_id, std::move(player));
+  return true;
+}
+
+std::optional<FlutterError> VideoPlayerTizenPlugin::ReleasePreloadedPlayers() {
+  player_preloader_.Clear();
+  return std::nullopt;
+}
+
+ErrorOr<flutter::EncodableMap> VideoPlayerTizenPlugin::GetStartupReport(
+    int64_t player_id) {
+  VideoPlayer *player = FindPlayerById(player_id);
+  if (!player) {
+    return FlutterError("Invalid argument", "Player not found");
+  }
+  return player->GetStartupReport();
+}
+
+ErrorOr<flutter::EncodableMap> VideoPlayerTizenPlugin::GetAbrTelemetry(
+    int64_t player_id) {
+  VideoPlayer *player = FindPlayerById(player_id);
+  if (!player) {
+    return FlutterError("Invalid argument", "Player not found");
+  }
+  return player->GetAbrTelemetry();
+}
+
+ErrorOr<PositionMessage> VideoPlayerTizenPlugin::EstimatedPosition(
+    const PlayerMessage &msg) {
+  VideoPlayer *player = FindPlayerById(msg.player_id());
+  if (!player) {
+    return FlutterError("Invalid argument", "Player not found");
+  }
+  PositionMessage result(msg.player_id(), player->GetEstimatedPosition());
+  return result;
+}
+
 std::optional<FlutterError> VideoPlayerTizenPlugin::SetMixWithOthers(
     const MixWithOthersMessage &msg) {
   options_.SetMixWithOthers(msg.mix_with_others());
@@ -0,0 +1,215 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "license_server_stub.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdlib>
+
+LicenseServerStub::LicenseServerStub(int latency_ms, size_t license_size)
+    : latency_ms_(latency_ms) {
+  license_.reserve(license_size);
+  for (size_t i = 0; i < license_size; i++) {
+    license_.push_back(static_cast<char>('A' + i % 26));
+  }
+}
+
+LicenseServerStub::~LicenseServerStub() { Stop(); }
+
+bool LicenseServerStub::Start() {
+  listen_fd_ = socket(AF_INET, SOCK_STREAM, 0);
+  if (listen_fd_ < 0) {
+    return false;
+  }
+  int enable = 1;
+  setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+  if (bind(listen_fd_, reinterpret_cast<sockaddr *>(&address),
+           sizeof(address)) != 0 ||
+      listen(listen_fd_, 64) != 0) {
+    close(listen_fd_);
+    listen_fd_ = -1;
+    return false;
+  }
+  socklen_t length = sizeof(address);
+  getsockname(listen_fd_, reinterpret_cast<sockaddr *>(&address), &length);
+  port_ = ntohs(address.sin_port);
+
+  stopped_ = false;
+  accept_thread_ = std::thread(&LicenseServerStub::AcceptLoop, this);
+  return true;
+}
+
+void LicenseServerStub::Stop() {
+  if (listen_fd_ < 0) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+    for (int fd : connection_fds_) {
+      shutdown(fd, SHUT_RDWR);
+    }
+  }
+  stop_cv_.notify_all();
+  if (accept_thread_.joinable()) {
+    accept_thread_.join();
+  }
+  for (std::thread &thread : connection_threads_) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+  connection_threads_.clear();
+  close(listen_fd_);
+  listen_fd_ = -1;
+}
+
+std::string LicenseServerStub::GetUrl(const std::string &path) const {
+  return "http://127.0.0.1:" + std::to_string(port_) + path;
+}
+
+void LicenseServerStub::ResetCounters() {
+  accepted_connections_ = 0;
+  served_requests_ = 0;
+}
+
+void LicenseServerStub::AcceptLoop() {
+  while (!stopped_) {
+    pollfd poll_fd = {listen_fd_, POLLIN, 0};
+    if (poll(&poll_fd, 1, 100) <= 0) {
+      continue;
+    }
+    int fd = accept(listen_fd_, nullptr, nullptr);
+    if (fd < 0) {
+      continue;
+    }
+    int enable = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+    accepted_connections_++;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+      close(fd);
+      break;
+    }
+    connection_fds_.push_back(fd);
+    connection_threads_.emplace_back(&LicenseServerStub::HandleConnection,
+                                     this, fd);
+  }
+}
+
+void LicenseServerStub::HandleConnection(int fd) {
+  std::string buffer;
+  std::string path;
+  while (!stopped_ && ReadRequest(fd, &buffer, &path)) {
+    if (path == "/slow") {
+      std::unique_lock<std::mutex> lock(mutex_);
+      stop_cv_.wait(lock, [this] { return stopped_.load(); });
+      break;
+    }
+    if (latency_ms_ > 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(latency_ms_));
+    }
+
+    bool written = false;
+    if (path == "/license") {
+      written = WriteResponse(fd, "200 OK", "", license_);
+    } else if (path == "/redirect") {
+      written = WriteResponse(fd, "302 Found",
+                              "Location: " + GetUrl("/license") + "\r\n", "");
+    } else {
+      written = WriteResponse(fd, "404 Not Found", "", "");
+    }
+    if (!written) {
+      break;
+    }
+    served_requests_++;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto iter = connection_fds_.begin(); iter != connection_fds_.end();
+       ++iter) {
+    if (*iter == fd) {
+      connection_fds_.erase(iter);
+      break;
+    }
+  }
+  close(fd);
+}
+
+bool LicenseServerStub::ReadRequest(int fd, std::string *buffer,
+                                    std::string *path) {
+  char chunk[4096];
+  size_t header_end = std::string::npos;
+  while ((header_end = buffer->find("\r\n\r\n")) == std::string::npos) {
+    ssize_t received = recv(fd, chunk, sizeof(chunk), 0);
+    if (received <= 0) {
+      return false;
+    }
+    buffer->append(chunk, received);
+  }
+
+  // Request line: "POST /license HTTP/1.1".
+  size_t path_start = buffer->find(' ');
+  size_t path_end = buffer->find(' ', path_start + 1);
+  if (path_start == std::string::npos || path_end == std::string::npos) {
+    return false;
+  }
+  *path = buffer->substr(path_start + 1, path_end - path_start - 1);
+
+  size_t content_length = 0;
+  std::string headers = buffer->substr(0, header_end);
+  const char *length_header = strcasestr(headers.c_str(), "Content-Length:");
+  if (length_header) {
+    content_length =
+        strtoul(length_header + sizeof("Content-Length:") - 1, nullptr, 10);
+  }
+
+  size_t request_size = header_end + 4 + content_length;
+  while (buffer->size() < request_size) {
+    ssize_t received = recv(fd, chunk, sizeof(chunk), 0);
+    if (received <= 0) {
+      return false;
+    }
+    buffer->append(chunk, received);
+  }
+  buffer->erase(0, request_size);
+  return true;
+}
+
+bool LicenseServerStub::WriteResponse(int fd, const std::string &status,
+                                      const std::string &extra_headers,
+                                      const std::string &body) {
+  std::string response = "HTTP/1.1 " + status +
+                         "\r\n"
+                         "Content-Type: application/octet-stream\r\n"
+                         "Content-Length: " +
+                         std::to_string(body.size()) +
+                         "\r\n"
+                         "Connection: keep-alive\r\n" +
+                         extra_headers + "\r\n" + body;
+  size_t sent = 0;
+  while (sent < response.size()) {
+    ssize_t result = send(fd, response.data() + sent, response.size() - sent,
+                          MSG_NOSIGNAL);
+    if (result <= 0) {
+      return false;
+    }
+    sent += result;
+  }
+  return true;
+}
@@ -0,0 +1,65 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_LICENSE_SERVER_STUB_H_
+#define FLUTTER_PLUGIN_LICENSE_SERVER_STUB_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// A minimal HTTP/1.1 server on the loopback interface that stands in for a
+// DRM license server.
+//
+// - POST /license responds 200 with a license body after |latency_ms|.
+// - POST /redirect responds 302 with a Location header pointing to /license.
+// - POST /slow does not respond until the server is stopped, which is used
+//   to measure how fast a request can be cancelled.
+// - Any other path responds 404.
+//
+// Connections are kept alive, so the number of accepted connections shows
+// whether the client reuses them.
+class LicenseServerStub {
+ public:
+  explicit LicenseServerStub(int latency_ms, size_t license_size);
+  ~LicenseServerStub();
+
+  // Starts listening on an ephemeral port. Returns false on failure.
+  bool Start();
+  void Stop();
+
+  std::string GetUrl(const std::string &path) const;
+  // Returns the body that is sent for /license.
+  const std::string &license() const { return license_; }
+
+  int accepted_connections() const { return accepted_connections_; }
+  int served_requests() const { return served_requests_; }
+  void ResetCounters();
+
+ private:
+  void AcceptLoop();
+  void HandleConnection(int fd);
+  bool ReadRequest(int fd, std::string *buffer, std::string *path);
+  bool WriteResponse(int fd, const std::string &status,
+                     const std::string &extra_headers,
+                     const std::string &body);
+
+  int latency_ms_;
+  std::string license_;
+  int listen_fd_ = -1;
+  int port_ = 0;
+  std::atomic<bool> stopped_{false};
+  std::atomic<int> accepted_connections_{0};
+  std::atomic<int> served_requests_{0};
+  std::thread accept_thread_;
+  std::mutex mutex_;
+  std::condition_variable stop_cv_;
+  std::vector<std::thread> connection_threads_;
+  std::vector<int> connection_fds_;
+};
+
+#endif  // FLUTTER_PLUGIN_LICENSE_SERVER_STUB_H_
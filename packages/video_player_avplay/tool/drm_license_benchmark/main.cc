@@ -0,0 +1,269 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Runs DrmLicenseHelper::DoTransactionTZ against a local license server stub
+// and reports latency, throughput, redirect handling and cancellation
+// responsiveness. Exits with a non-zero status if a transaction returns an
+// unexpected result.
+
+#include <curl/curl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "drm_license_helper.h"
+#include "license_server_stub.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// How long a request to /slow runs before it is cancelled.
+constexpr int kCancelAfterMs = 100;
+
+struct Options {
+  int requests = 50;
+  int concurrency = 8;
+  int latency_ms = 20;
+  size_t license_size = 4096;
+  long idle_timeout = DrmLicenseHelper::kDefaultConnectionIdleTimeout;
+};
+
+// A PlayReady-like challenge. Its content does not matter to the stub.
+const char kChallenge[] =
+    "<?xml version=\"1.0\" encoding=\"utf-8\"?><soap:Envelope "
+    "xmlns:soap=\"http://schemas.xmlsoap.org/soap/envelope/\"><soap:Body>"
+    "<AcquireLicense/></soap:Body></soap:Envelope>";
+
+double ToMilliseconds(Clock::duration duration) {
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+double Percentile(std::vector<double> values, double percentile) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::sort(values.begin(), values.end());
+  size_t index = static_cast<size_t>(percentile / 100 * (values.size() - 1));
+  return values[index];
+}
+
+// Performs a single transaction and returns whether the expected license was
+// received. |elapsed_ms| is set in either case.
+bool Transact(const LicenseServerStub &server, const std::string &url,
+              double *elapsed_ms,
+              DrmLicenseHelper::SExtensionCtxTZ *ext_ctx = nullptr,
+              DRM_RESULT *result = nullptr) {
+  unsigned char *response = nullptr;
+  unsigned long response_len = 0;
+  Clock::time_point start = Clock::now();
+  DRM_RESULT ret = DrmLicenseHelper::DoTransactionTZ(
+      url.c_str(), kChallenge, sizeof(kChallenge) - 1, &response,
+      &response_len, DrmLicenseHelper::kPlayReady, nullptr, ext_ctx);
+  *elapsed_ms = ToMilliseconds(Clock::now() - start);
+  if (result) {
+    *result = ret;
+  }
+  bool valid = ret == DRM_SUCCESS && response &&
+               response_len == server.license().size() &&
+               memcmp(response, server.license().data(), response_len) == 0;
+  free(response);
+  return valid;
+}
+
+void PrintLatency(const char *name, const std::vector<double> &latencies,
+                  double total_ms, int connections) {
+  double sum = 0;
+  for (double latency : latencies) {
+    sum += latency;
+  }
+  printf(
+      "%-24s n=%-4zu mean=%7.2fms p50=%7.2fms p95=%7.2fms max=%7.2fms "
+      "rate=%8.1f/s connections=%d\n",
+      name, latencies.size(), latencies.empty() ? 0 : sum / latencies.size(),
+      Percentile(latencies, 50), Percentile(latencies, 95),
+      Percentile(latencies, 100),
+      total_ms > 0 ? latencies.size() * 1000 / total_ms : 0, connections);
+}
+
+bool RunSequential(LicenseServerStub &server, const Options &options,
+                   const char *name, long idle_timeout) {
+  DrmLicenseHelper::SetConnectionIdleTimeout(idle_timeout);
+  server.ResetCounters();
+  std::vector<double> latencies;
+  Clock::time_point start = Clock::now();
+  for (int i = 0; i < options.requests; i++) {
+    double latency = 0;
+    if (!Transact(server, server.GetUrl("/license"), &latency)) {
+      fprintf(stderr, "%s: transaction %d failed.\n", name, i);
+      return false;
+    }
+    latencies.push_back(latency);
+  }
+  PrintLatency(name, latencies, ToMilliseconds(Clock::now() - start),
+               server.accepted_connections());
+  return true;
+}
+
+bool RunConcurrent(LicenseServerStub &server, const Options &options) {
+  DrmLicenseHelper::SetConnectionIdleTimeout(options.idle_timeout);
+  server.ResetCounters();
+  std::vector<std::vector<double>> latencies(options.concurrency);
+  std::atomic<int> failures{0};
+  std::vector<std::thread> threads;
+  Clock::time_point start = Clock::now();
+  for (int t = 0; t < options.concurrency; t++) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < options.requests; i++) {
+        double latency = 0;
+        if (!Transact(server, server.GetUrl("/license"), &latency)) {
+          failures++;
+          continue;
+        }
+        latencies[t].push_back(latency);
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  double total_ms = ToMilliseconds(Clock::now() - start);
+
+  std::vector<double> all;
+  for (const std::vector<double> &thread_latencies : latencies) {
+    all.insert(all.end(), thread_latencies.begin(), thread_latencies.end());
+  }
+  std::string name = "concurrent (x" + std::to_string(options.concurrency) +
+                     ")";
+  PrintLatency(name.c_str(), all, total_ms, server.accepted_connections());
+  if (failures > 0) {
+    fprintf(stderr, "%s: %d transactions failed.\n", name.c_str(),
+            failures.load());
+    return false;
+  }
+  return true;
+}
+
+bool RunRedirect(LicenseServerStub &server, const Options &options) {
+  DrmLicenseHelper::SetConnectionIdleTimeout(options.idle_timeout);
+  server.ResetCounters();
+  std::vector<double> latencies;
+  Clock::time_point start = Clock::now();
+  for (int i = 0; i < options.requests; i++) {
+    double latency = 0;
+    if (!Transact(server, server.GetUrl("/redirect"), &latency)) {
+      fprintf(stderr, "redirect: transaction %d failed.\n", i);
+      return false;
+    }
+    latencies.push_back(latency);
+  }
+  PrintLatency("redirect", latencies, ToMilliseconds(Clock::now() - start),
+               server.accepted_connections());
+  return true;
+}
+
+bool RunCancellation(LicenseServerStub &server, const Options &options) {
+  DrmLicenseHelper::SetConnectionIdleTimeout(options.idle_timeout);
+  constexpr int kRuns = 3;
+  std::vector<double> delays;
+  for (int i = 0; i < kRuns; i++) {
+    DrmLicenseHelper::SExtensionCtxTZ ext_ctx;
+    std::thread canceller([&ext_ctx] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(kCancelAfterMs));
+      ext_ctx.cancel_request = true;
+    });
+    DRM_RESULT result = DRM_SUCCESS;
+    double elapsed = 0;
+    Transact(server, server.GetUrl("/slow"), &elapsed, &ext_ctx, &result);
+    canceller.join();
+    if (result != DRM_E_NETWORK_CANCELED) {
+      fprintf(stderr, "cancellation: unexpected result 0x%lx.\n", result);
+      return false;
+    }
+    delays.push_back(std::max(0.0, elapsed - kCancelAfterMs));
+  }
+  double sum = 0;
+  for (double delay : delays) {
+    sum += delay;
+  }
+  printf("%-24s n=%-4zu mean=%7.2fms max=%7.2fms (delay after cancel)\n",
+         "cancellation", delays.size(), sum / delays.size(),
+         Percentile(delays, 100));
+  return true;
+}
+
+void PrintUsage(const char *program) {
+  printf(
+      "Usage: %s [options]\n"
+      "  --requests=N       Transactions per scenario and thread (50)\n"
+      "  --concurrency=N    Threads in the concurrent scenario (8)\n"
+      "  --latency-ms=N     Server processing time per request (20)\n"
+      "  --license-size=N   License response size in bytes (4096)\n"
+      "  --idle-timeout=N   Connection idle timeout in seconds (30)\n",
+      program);
+}
+
+bool ParseOptions(int argc, char **argv, Options *options) {
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    const char *value = strchr(arg, '=');
+    if (!value) {
+      return false;
+    }
+    std::string name(arg, value - arg);
+    long number = strtol(value + 1, nullptr, 10);
+    if (name == "--requests" && number > 0) {
+      options->requests = number;
+    } else if (name == "--concurrency" && number > 0) {
+      options->concurrency = number;
+    } else if (name == "--latency-ms" && number >= 0) {
+      options->latency_ms = number;
+    } else if (name == "--license-size" && number > 0) {
+      options->license_size = number;
+    } else if (name == "--idle-timeout" && number >= 0) {
+      options->idle_timeout = number;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options options;
+  if (!ParseOptions(argc, argv, &options)) {
+    PrintUsage(argv[0]);
+    return 2;
+  }
+
+  curl_global_init(CURL_GLOBAL_ALL);
+  LicenseServerStub server(options.latency_ms, options.license_size);
+  if (!server.Start()) {
+    fprintf(stderr, "Failed to start the license server stub.\n");
+    return 1;
+  }
+  printf("license server: %s, latency: %dms, license size: %zu bytes\n",
+         server.GetUrl("/").c_str(), options.latency_ms,
+         options.license_size);
+
+  bool succeeded =
+      RunSequential(server, options, "sequential (no reuse)", 0) &&
+      RunSequential(server, options, "sequential (pooled)",
+                    options.idle_timeout) &&
+      RunConcurrent(server, options) && RunRedirect(server, options) &&
+      RunCancellation(server, options);
+
+  server.Stop();
+  curl_global_cleanup();
+  return succeeded ? 0 : 1;
+}
@@ -0,0 +1,244 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Plays the role of a player against SegmentCacheProxy and a local origin
+// stub, and checks manifest rewriting, cache hits, prefetching, range
+// requests, origin restriction and eviction. Exits with a non-zero status if
+// any check fails.
+
+#include <curl/curl.h>
+#include <stdio.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "origin_stub.h"
+#include "segment_cache_proxy.h"
+
+namespace {
+
+constexpr int kSegmentCount = 10;
+constexpr size_t kSegmentSize = 8 * 1024;
+constexpr size_t kCacheSize = 1024 * 1024;
+// Holds only a few segments, to check eviction.
+constexpr size_t kSmallCacheSize = 4 * kSegmentSize;
+constexpr int kPrefetchCount = 2;
+// How long to wait for prefetches to complete.
+constexpr int kPrefetchTimeoutMs = 2000;
+
+int failures = 0;
+
+void Check(bool condition, const std::string &description) {
+  printf("[%s] %s\n", condition ? "PASS" : "FAIL", description.c_str());
+  if (!condition) {
+    failures++;
+  }
+}
+
+size_t WriteBody(char *data, size_t size, size_t count, void *user_data) {
+  static_cast<std::string *>(user_data)->append(data, size * count);
+  return size * count;
+}
+
+// Fetches |url| and returns the status code, or 0 on a transport error.
+long Get(const std::string &url, std::string *body,
+         const std::string &range = "") {
+  CURL *curl = curl_easy_init();
+  curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteBody);
+  curl_easy_setopt(curl, CURLOPT_WRITEDATA, body);
+  if (!range.empty()) {
+    curl_easy_setopt(curl, CURLOPT_RANGE, range.c_str());
+  }
+  long status = 0;
+  if (curl_easy_perform(curl) == CURLE_OK) {
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status);
+  }
+  curl_easy_cleanup(curl);
+  return status;
+}
+
+// Waits until the origin has received a request for |path|.
+bool WaitForRequest(OriginStub &origin, const std::string &path) {
+  auto deadline = std::chrono::steady_clock::now() +
+                  std::chrono::milliseconds(kPrefetchTimeoutMs);
+  while (origin.GetRequestCount(path) == 0) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return true;
+}
+
+// Fetches the segment at |path| through |proxy| and checks its body.
+bool GetSegment(OriginStub &origin, SegmentCacheProxy &proxy,
+                const std::string &path) {
+  std::string body;
+  long status = Get(proxy.GetProxyUrl(origin.GetUrl(path)), &body);
+  return status == 200 && body == origin.GetSegment(path);
+}
+
+void CheckHls(OriginStub &origin) {
+  SegmentCacheProxy proxy(kCacheSize, kPrefetchCount);
+  if (!proxy.Start()) {
+    Check(false, "HLS: start proxy");
+    return;
+  }
+
+  std::string master;
+  long status = Get(proxy.GetProxyUrl(origin.GetUrl("/hls/master.m3u8")),
+                    &master);
+  Check(status == 200 &&
+            master.find(proxy.GetProxyUrl(origin.GetUrl("/hls/media.m3u8"))) !=
+                std::string::npos,
+        "HLS: variant URIs are rewritten to the proxy");
+
+  std::string media;
+  status =
+      Get(proxy.GetProxyUrl(origin.GetUrl("/hls/media.m3u8")), &media);
+  Check(status == 200 &&
+            media.find("URI=\"" +
+                       proxy.GetProxyUrl(origin.GetUrl("/hls/init.mp4")) +
+                       "\"") != std::string::npos &&
+            media.find(proxy.GetProxyUrl(origin.GetUrl("/hls/seg0.ts"))) !=
+                std::string::npos,
+        "HLS: segment and map URIs are rewritten to the proxy");
+
+  Check(GetSegment(origin, proxy, "/hls/seg0.ts"),
+        "HLS: a segment is served on a cache miss");
+  Check(WaitForRequest(origin, "/hls/seg1.ts") &&
+            WaitForRequest(origin, "/hls/seg2.ts"),
+        "HLS: the next two segments are prefetched");
+
+  Check(GetSegment(origin, proxy, "/hls/seg1.ts") &&
+            origin.GetRequestCount("/hls/seg1.ts") == 1,
+        "HLS: a prefetched segment is served from the cache");
+  Check(GetSegment(origin, proxy, "/hls/seg0.ts") &&
+            origin.GetRequestCount("/hls/seg0.ts") == 1,
+        "HLS: a played segment is served from the cache");
+
+  std::string part;
+  status = Get(proxy.GetProxyUrl(origin.GetUrl("/hls/seg1.ts")), &part,
+               "100-199");
+  Check(status == 206 &&
+            part == origin.GetSegment("/hls/seg1.ts").substr(100, 100) &&
+            origin.GetRequestCount("/hls/seg1.ts") == 1,
+        "HLS: a range of a cached segment is served from the cache");
+
+  part.clear();
+  status = Get(proxy.GetProxyUrl(origin.GetUrl("/hls/seg1.ts")), &part,
+               "99999999999999999999999-");
+  Check(status == 416, "HLS: an invalid range is rejected");
+
+  std::string other_url = proxy.GetProxyUrl(origin.GetUrl("/hls/seg1.ts"));
+  other_url = other_url.substr(0, other_url.find("/http/") + 6) +
+              "example.invalid/hls/seg1.ts";
+  std::string other;
+  Check(Get(other_url, &other) == 403,
+        "HLS: requests for other origins are rejected");
+
+  status = Get(proxy.GetProxyUrl(origin.GetUrl("/hls/media.m3u8")), &media);
+  Check(origin.GetRequestCount("/hls/media.m3u8") == 2,
+        "HLS: playlists are not cached");
+
+  SegmentCacheProxy::Statistics statistics = proxy.GetStatistics();
+  printf("  hits: %lld, misses: %lld, prefetches: %lld\n",
+         static_cast<long long>(statistics.hits),
+         static_cast<long long>(statistics.misses),
+         static_cast<long long>(statistics.prefetches));
+  Check(statistics.hits == 4 && statistics.misses == 1,
+        "HLS: hits and misses are counted");
+}
+
+void CheckDash(OriginStub &origin) {
+  SegmentCacheProxy proxy(kCacheSize, kPrefetchCount);
+  if (!proxy.Start()) {
+    Check(false, "DASH: start proxy");
+    return;
+  }
+
+  std::string manifest;
+  long status = Get(proxy.GetProxyUrl(origin.GetUrl("/dash/manifest.mpd")),
+                    &manifest);
+  Check(status == 200 &&
+            manifest.find("<BaseURL>" +
+                          proxy.GetProxyUrl(origin.GetUrl("/dash/")) +
+                          "</BaseURL>") != std::string::npos &&
+            manifest.find("xmlns=\"urn:mpeg:dash:schema:mpd:2011\"") !=
+                std::string::npos,
+        "DASH: BaseURL is rewritten to the proxy");
+
+  std::string root_manifest;
+  status = Get(proxy.GetProxyUrl(origin.GetUrl("/dash/root.mpd")),
+               &root_manifest);
+  Check(status == 200 &&
+            root_manifest.find("<BaseURL>" +
+                               proxy.GetProxyUrl(origin.GetUrl("/dash/")) +
+                               "</BaseURL>") != std::string::npos,
+        "DASH: a root-relative BaseURL is rewritten to the proxy");
+
+  Check(GetSegment(origin, proxy, "/dash/v1/seg-001.m4s"),
+        "DASH: a segment is served on a cache miss");
+  Check(WaitForRequest(origin, "/dash/v1/seg-002.m4s") &&
+            WaitForRequest(origin, "/dash/v1/seg-003.m4s"),
+        "DASH: the next two $Number$ segments are prefetched");
+  Check(GetSegment(origin, proxy, "/dash/v1/seg-002.m4s") &&
+            origin.GetRequestCount("/dash/v1/seg-002.m4s") == 1,
+        "DASH: a prefetched segment is served from the cache");
+}
+
+void CheckEviction(OriginStub &origin) {
+  SegmentCacheProxy proxy(kSmallCacheSize, 0);
+  if (!proxy.Start()) {
+    Check(false, "Eviction: start proxy");
+    return;
+  }
+
+  std::string media;
+  Get(proxy.GetProxyUrl(origin.GetUrl("/hls/media.m3u8")), &media);
+  bool valid = true;
+  for (int i = 0; i < origin.segment_count(); i++) {
+    valid &= GetSegment(origin, proxy, "/hls/seg" + std::to_string(i) + ".ts");
+  }
+  SegmentCacheProxy::Statistics statistics = proxy.GetStatistics();
+  Check(valid && statistics.evictions > 0 &&
+            statistics.cached_size <= kSmallCacheSize,
+        "Eviction: the cache stays within its size");
+
+  int requests = origin.GetRequestCount("/hls/seg0.ts");
+  Check(GetSegment(origin, proxy, "/hls/seg0.ts") &&
+            origin.GetRequestCount("/hls/seg0.ts") == requests + 1,
+        "Eviction: the least recently used segment is evicted");
+}
+
+}  // namespace
+
+int main() {
+  curl_global_init(CURL_GLOBAL_DEFAULT);
+
+  {
+    OriginStub origin(kSegmentCount, kSegmentSize);
+    if (!origin.Start()) {
+      fprintf(stderr, "Failed to start the origin stub.\n");
+      return 1;
+    }
+    CheckHls(origin);
+  }
+  {
+    OriginStub origin(kSegmentCount, kSegmentSize);
+    origin.Start();
+    CheckDash(origin);
+  }
+  {
+    OriginStub origin(kSegmentCount, kSegmentSize);
+    origin.Start();
+    CheckEviction(origin);
+  }
+
+  curl_global_cleanup();
+  printf("%s\n", failures == 0 ? "All checks passed." : "Some checks failed.");
+  return failures == 0 ? 0 : 1;
+}
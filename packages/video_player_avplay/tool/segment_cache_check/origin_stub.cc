@@ -0,0 +1,237 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "origin_stub.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstdlib>
+
+namespace {
+
+bool StartsWith(const std::string &value, const std::string &prefix) {
+  return value.compare(0, prefix.size(), prefix) == 0;
+}
+
+bool WriteAll(int fd, const std::string &data) {
+  size_t sent = 0;
+  while (sent < data.size()) {
+    ssize_t result =
+        send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+    if (result <= 0) {
+      return false;
+    }
+    sent += result;
+  }
+  return true;
+}
+
+}  // namespace
+
+OriginStub::OriginStub(int segment_count, size_t segment_size)
+    : segment_count_(segment_count), segment_size_(segment_size) {}
+
+OriginStub::~OriginStub() { Stop(); }
+
+bool OriginStub::Start() {
+  listen_fd_ = socket(AF_INET, SOCK_STREAM, 0);
+  if (listen_fd_ < 0) {
+    return false;
+  }
+  int enable = 1;
+  setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+  if (bind(listen_fd_, reinterpret_cast<sockaddr *>(&address),
+           sizeof(address)) != 0 ||
+      listen(listen_fd_, 64) != 0) {
+    close(listen_fd_);
+    listen_fd_ = -1;
+    return false;
+  }
+  socklen_t length = sizeof(address);
+  getsockname(listen_fd_, reinterpret_cast<sockaddr *>(&address), &length);
+  port_ = ntohs(address.sin_port);
+
+  stopped_ = false;
+  accept_thread_ = std::thread(&OriginStub::AcceptLoop, this);
+  return true;
+}
+
+void OriginStub::Stop() {
+  if (listen_fd_ < 0) {
+    return;
+  }
+  stopped_ = true;
+  if (accept_thread_.joinable()) {
+    accept_thread_.join();
+  }
+  for (std::thread &thread : connection_threads_) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+  connection_threads_.clear();
+  close(listen_fd_);
+  listen_fd_ = -1;
+}
+
+std::string OriginStub::GetUrl(const std::string &path) const {
+  return "http://127.0.0.1:" + std::to_string(port_) + path;
+}
+
+std::string OriginStub::GetSegment(const std::string &path) const {
+  std::string body;
+  body.reserve(segment_size_);
+  while (body.size() < segment_size_) {
+    body += path + ";";
+  }
+  body.resize(segment_size_);
+  return body;
+}
+
+int OriginStub::GetRequestCount(const std::string &path) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return request_counts_[path];
+}
+
+void OriginStub::AcceptLoop() {
+  while (!stopped_) {
+    pollfd poll_fd = {listen_fd_, POLLIN, 0};
+    if (poll(&poll_fd, 1, 100) <= 0) {
+      continue;
+    }
+    int fd = accept(listen_fd_, nullptr, nullptr);
+    if (fd < 0) {
+      continue;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    connection_threads_.emplace_back(&OriginStub::HandleConnection, this, fd);
+  }
+}
+
+void OriginStub::HandleConnection(int fd) {
+  std::string buffer;
+  char chunk[4096];
+  size_t header_end = std::string::npos;
+  while (!stopped_ &&
+         (header_end = buffer.find("\r\n\r\n")) == std::string::npos) {
+    pollfd poll_fd = {fd, POLLIN, 0};
+    if (poll(&poll_fd, 1, 100) <= 0) {
+      continue;
+    }
+    ssize_t received = recv(fd, chunk, sizeof(chunk), 0);
+    if (received <= 0) {
+      close(fd);
+      return;
+    }
+    buffer.append(chunk, received);
+  }
+  if (header_end == std::string::npos) {
+    close(fd);
+    return;
+  }
+
+  // Request line: "GET /hls/seg0.ts HTTP/1.1".
+  std::string headers = buffer.substr(0, header_end);
+  size_t path_start = headers.find(' ') + 1;
+  std::string path =
+      headers.substr(path_start, headers.find(' ', path_start) - path_start);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    request_counts_[path]++;
+  }
+
+  std::string content_type;
+  std::string body;
+  if (!GetResponse(path, &content_type, &body)) {
+    WriteAll(fd,
+             "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n"
+             "Connection: close\r\n\r\n");
+    close(fd);
+    return;
+  }
+
+  std::string status = "200 OK";
+  std::string content_range;
+  const char *range = strcasestr(headers.c_str(), "\r\nRange: bytes=");
+  if (range) {
+    char *end = nullptr;
+    size_t first = strtoul(range + sizeof("\r\nRange: bytes=") - 1, &end, 10);
+    size_t last = strtoul(end + 1, nullptr, 10);
+    if (last == 0 || last >= body.size()) {
+      last = body.size() - 1;
+    }
+    content_range = "Content-Range: bytes " + std::to_string(first) + "-" +
+                    std::to_string(last) + "/" +
+                    std::to_string(body.size()) + "\r\n";
+    body = body.substr(first, last - first + 1);
+    status = "206 Partial Content";
+  }
+
+  WriteAll(fd, "HTTP/1.1 " + status + "\r\nContent-Type: " + content_type +
+                   "\r\n" + content_range +
+                   "Content-Length: " + std::to_string(body.size()) +
+                   "\r\nConnection: close\r\n\r\n" + body);
+  close(fd);
+}
+
+bool OriginStub::GetResponse(const std::string &path,
+                             std::string *content_type, std::string *body) {
+  if (path == "/hls/master.m3u8") {
+    *content_type = "application/vnd.apple.mpegurl";
+    *body =
+        "#EXTM3U\n"
+        "#EXT-X-STREAM-INF:BANDWIDTH=800000\n"
+        "media.m3u8\n";
+  } else if (path == "/hls/media.m3u8") {
+    *content_type = "application/vnd.apple.mpegurl";
+    *body =
+        "#EXTM3U\n"
+        "#EXT-X-VERSION:7\n"
+        "#EXT-X-TARGETDURATION:2\n"
+        "#EXT-X-MAP:URI=\"init.mp4\"\n";
+    for (int i = 0; i < segment_count_; i++) {
+      *body += "#EXTINF:2.0,\nseg" + std::to_string(i) + ".ts\n";
+    }
+    *body += "#EXT-X-ENDLIST\n";
+  } else if (path == "/dash/manifest.mpd" || path == "/dash/root.mpd") {
+    // root.mpd refers to the segments with a root-relative BaseURL.
+    *content_type = "application/dash+xml";
+    *body =
+        "<?xml version=\"1.0\"?>\n"
+        "<MPD xmlns=\"urn:mpeg:dash:schema:mpd:2011\" type=\"static\">\n"
+        "  <BaseURL>" +
+        (path == "/dash/root.mpd" ? std::string("/dash/")
+                                  : GetUrl("/dash/")) +
+        "</BaseURL>\n"
+        "  <Period>\n"
+        "    <AdaptationSet mimeType=\"video/mp4\">\n"
+        "      <SegmentTemplate timescale=\"1000\" duration=\"2000\"\n"
+        "          startNumber=\"1\" initialization=\"$RepresentationID$/"
+        "init.mp4\"\n"
+        "          media=\"$RepresentationID$/seg-$Number%03d$.m4s\"/>\n"
+        "      <Representation id=\"v1\" bandwidth=\"800000\"/>\n"
+        "    </AdaptationSet>\n"
+        "  </Period>\n"
+        "</MPD>\n";
+  } else if ((StartsWith(path, "/hls/") && path.find(".m3u8") ==
+                                                 std::string::npos) ||
+             (StartsWith(path, "/dash/") && path.find(".mpd") ==
+                                                  std::string::npos)) {
+    *content_type = "video/mp4";
+    *body = GetSegment(path);
+  } else {
+    return false;
+  }
+  return true;
+}
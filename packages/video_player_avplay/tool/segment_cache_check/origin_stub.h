@@ -0,0 +1,61 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_ORIGIN_STUB_H_
+#define FLUTTER_PLUGIN_ORIGIN_STUB_H_
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// A minimal HTTP/1.1 origin server on the loopback interface that serves a
+// small HLS and DASH stream.
+//
+// - /hls/master.m3u8 lists the media playlist /hls/media.m3u8.
+// - /hls/media.m3u8 lists /hls/init.mp4 and /hls/seg<N>.ts with relative
+//   URIs.
+// - /dash/manifest.mpd has an absolute BaseURL and a SegmentTemplate with
+//   media="$RepresentationID$/seg-$Number%03d$.m4s", starting at 1.
+// - Segment bodies are derived from their path, and single byte ranges are
+//   supported.
+// - Any other path responds 404.
+//
+// The number of requests received for each path is recorded.
+class OriginStub {
+ public:
+  OriginStub(int segment_count, size_t segment_size);
+  ~OriginStub();
+
+  // Starts listening on an ephemeral port. Returns false on failure.
+  bool Start();
+  void Stop();
+
+  std::string GetUrl(const std::string &path) const;
+  int segment_count() const { return segment_count_; }
+
+  // Returns the body served for the segment at |path|.
+  std::string GetSegment(const std::string &path) const;
+  int GetRequestCount(const std::string &path);
+
+ private:
+  void AcceptLoop();
+  void HandleConnection(int fd);
+  bool GetResponse(const std::string &path, std::string *content_type,
+                   std::string *body);
+
+  int segment_count_;
+  size_t segment_size_;
+  int listen_fd_ = -1;
+  int port_ = 0;
+  std::atomic<bool> stopped_{false};
+  std::thread accept_thread_;
+  std::mutex mutex_;
+  std::vector<std::thread> connection_threads_;
+  std::map<std::string, int> request_counts_;
+};
+
+#endif  // FLUTTER_PLUGIN_ORIGIN_STUB_H_
@@ -0,0 +1,43 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Host stand-in for the Tizen dlog API used by log.h. Only warnings and errors
+// are printed unless SEGMENT_CACHE_CHECK_VERBOSE is set.
+
+#ifndef FLUTTER_PLUGIN_SEGMENT_CACHE_CHECK_DLOG_H_
+#define FLUTTER_PLUGIN_SEGMENT_CACHE_CHECK_DLOG_H_
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef enum {
+  DLOG_UNKNOWN = 0,
+  DLOG_DEFAULT,
+  DLOG_VERBOSE,
+  DLOG_DEBUG,
+  DLOG_INFO,
+  DLOG_WARN,
+  DLOG_ERROR,
+  DLOG_FATAL,
+  DLOG_SILENT,
+} log_priority;
+
+static inline int dlog_print(log_priority prio, const char *tag,
+                             const char *fmt, ...) {
+  static const bool verbose = getenv("SEGMENT_CACHE_CHECK_VERBOSE") != nullptr;
+  if (prio < DLOG_WARN && !verbose) {
+    return 0;
+  }
+  va_list args;
+  va_start(args, fmt);
+  fprintf(stderr, "[%s] ", tag);
+  vfprintf(stderr, fmt, args);
+  fprintf(stderr, "\n");
+  va_end(args);
+  return 0;
+}
+
+#endif  // FLUTTER_PLUGIN_SEGMENT_CACHE_CHECK_DLOG_H_
@@ -326,6 +326,20 @@ class VideoPlayerTizen extends VideoPlayerPlatform {
     );
   }
 
+  @override
+  Future<bool> setMultiviewLayout(Map<int, Rect> windows) {
+    return _api.setMultiviewLayout(<GeometryMessage?>[
+      for (final MapEntry<int, Rect> window in windows.entries)
+        GeometryMessage(
+          playerId: window.key,
+          x: window.value.left.toInt(),
+          y: window.value.top.toInt(),
+          width: window.value.width.toInt(),
+          height: window.value.height.toInt(),
+        ),
+    ]);
+  }
+
   EventChannel _eventChannelFor(int playerId) {
     return EventChannel('tizen/video_player/video_events_$playerId');
   }
@@ -928,6 +928,32 @@ class VideoPlayerController extends ValueNotifier<VideoPlayerValue> {
 
     return _videoPlayerPlatform.setDisplayRotate(_playerId, rotation);
   }
+
+  /// Shows several players at once, e.g. for picture-in-picture.
+  ///
+  /// [windows] maps controllers to their display geometry in physical
+  /// pixels. All windows are updated in a single platform call. The largest
+  /// window plays at full quality, while smaller ones are limited to a stream
+  /// variant that fits their size. Players that exceed the hardware decoder
+  /// limit, or that were part of the previous layout but are omitted, are
+  /// paused and released to free their decoders. They are recreated where
+  /// they left off when they are shown again, and resume playing unless they
+  /// were paused in the meantime.
+  ///
+  /// Z-order is not supported: the stacking order of overlapping windows
+  /// cannot be controlled, so windows should not overlap.
+  ///
+  /// An empty map ends the multiview layout and restores all players.
+  static Future<bool> setMultiviewLayout(
+    Map<VideoPlayerController, Rect> windows,
+  ) {
+    return _videoPlayerPlatform.setMultiviewLayout(<int, Rect>{
+      for (final MapEntry<VideoPlayerController, Rect> window
+          in windows.entries)
+        if (!window.key._isDisposedOrNotInitialized)
+          window.key._playerId: window.value,
+    });
+  }
 }
 
 class _VideoAppLifeCycleObserver extends Object with WidgetsBindingObserver {
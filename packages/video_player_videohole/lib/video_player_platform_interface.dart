@@ -171,6 +171,15 @@ abstract class VideoPlayerPlatform extends PlatformInterface {
   Future<bool> setDisplayRotate(int playerId, DisplayRotation rotation) {
     throw UnimplementedError('setDisplayRotate() has not been implemented.');
   }
+
+  /// Arranges several players on the screen at once.
+  ///
+  /// [windows] maps player IDs to their display geometry. Z-order is not
+  /// supported, so windows should not overlap. An empty map ends the
+  /// multiview layout.
+  Future<bool> setMultiviewLayout(Map<int, Rect> windows) {
+    throw UnimplementedError('setMultiviewLayout() has not been implemented.');
+  }
 }
 
 /// Description of the data source used to create an instance of
@@ -120,4 +120,5 @@ abstract class VideoPlayerVideoholeApi {
   void suspend(int playerId);
   void restore(int playerId, CreateMessage? msg, int resumeTime);
   bool setDisplayRotate(RotationMessage msg);
+  bool setMultiviewLayout(List<GeometryMessage?> geometries);
 }
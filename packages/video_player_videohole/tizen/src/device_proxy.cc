@@ -4,37 +4,11 @@
 
 #include "device_proxy.h"
 
-#include <dlfcn.h>
-
-#include "log.h"
-
-typedef power_state_e (*FunDevicePowerGetState)(void);
-
-DeviceProxy::DeviceProxy() {
-  power_state_handle_ = dlopen("libdeviced.so.1", RTLD_LAZY);
-  if (power_state_handle_ == nullptr) {
-    LOG_ERROR("Failed to open libdeviced.so.1");
-  }
-}
-
-DeviceProxy::~DeviceProxy() {
-  if (power_state_handle_) {
-    dlclose(power_state_handle_);
-    power_state_handle_ = nullptr;
-  }
-}
+DeviceProxy::DeviceProxy() { library_.ReportMissingSymbols(); }
 
 power_state_e DeviceProxy::device_power_get_state(void) {
-  if (!power_state_handle_) {
-    LOG_ERROR("power_state_handle_ is invalid.");
-    return POWER_STATE_ERROR;
-  }
-  FunDevicePowerGetState device_power_get_state =
-      reinterpret_cast<FunDevicePowerGetState>(
-          dlsym(power_state_handle_, "device_power_get_state"));
-  if (!device_power_get_state) {
-    LOG_ERROR("Failed to find device_power_get_state function.");
+  if (!device_power_get_state_) {
     return POWER_STATE_ERROR;
   }
-  return device_power_get_state();
+  return device_power_get_state_();
 }
@@ -5,6 +5,8 @@
 #ifndef FLUTTER_PLUGIN_DEVICE_PROXY_H_
 #define FLUTTER_PLUGIN_DEVICE_PROXY_H_
 
+#include "dynamic_library.h"
+
 typedef enum {
   POWER_STATE_NORMAL,          /**< Normal state */
   POWER_STATE_PICTUREOFF,      /**< Picture off state */
@@ -17,11 +19,13 @@ typedef enum {
 class DeviceProxy {
  public:
   DeviceProxy();
-  ~DeviceProxy();
+  ~DeviceProxy() = default;
   power_state_e device_power_get_state(void);
 
  private:
-  void* power_state_handle_ = nullptr;
+  DynamicLibrary library_{"libdeviced.so.1"};
+  DynamicFunction<power_state_e()> device_power_get_state_{
+      library_, "device_power_get_state"};
 };
 
 #endif  // FLUTTER_PLUGIN_DEVICE_PROXY_H_
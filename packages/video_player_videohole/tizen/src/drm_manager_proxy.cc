@@ -6,6 +6,9 @@
 
 #include <dlfcn.h>
 
+#include "dynamic_library.h"
+#include "log.h"
+
 FuncDMGRSetData DMGRSetData = nullptr;
 FuncDMGRGetData DMGRGetData = nullptr;
 FuncDMGRSetDRMLocalMode DMGRSetDRMLocalMode = nullptr;
@@ -20,41 +23,21 @@ int InitDrmManagerProxy(void* handle) {
     return DM_ERROR_INVALID_PARAM;
   }
 
-  DMGRSetData = reinterpret_cast<FuncDMGRSetData>(dlsym(handle, "DMGRSetData"));
-  if (!DMGRSetData) {
-    return DM_ERROR_DL;
-  }
-
-  DMGRGetData = reinterpret_cast<FuncDMGRGetData>(dlsym(handle, "DMGRGetData"));
-  if (!DMGRGetData) {
-    return DM_ERROR_DL;
-  }
-
-  DMGRSetDRMLocalMode = reinterpret_cast<FuncDMGRSetDRMLocalMode>(
-      dlsym(handle, "DMGRSetDRMLocalMode"));
-  if (!DMGRSetDRMLocalMode) {
-    return DM_ERROR_DL;
-  }
-
-  DMGRCreateDRMSession = reinterpret_cast<FuncDMGRCreateDRMSession>(
-      dlsym(handle, "DMGRCreateDRMSession"));
-  if (!DMGRCreateDRMSession) {
-    return DM_ERROR_DL;
-  }
-
-  DMGRSecurityInitCompleteCB = reinterpret_cast<FuncDMGRSecurityInitCompleteCB>(
-      dlsym(handle, "DMGRSecurityInitCompleteCB"));
-  if (!DMGRSecurityInitCompleteCB) {
-    return DM_ERROR_DL;
-  }
-
-  DMGRReleaseDRMSession = reinterpret_cast<FuncDMGRReleaseDRMSession>(
-      dlsym(handle, "DMGRReleaseDRMSession"));
-  if (!DMGRReleaseDRMSession) {
-    return DM_ERROR_DL;
-  }
-
-  return DM_ERROR_NONE;
+  // Resolve every symbol so that all missing ones are reported at once.
+  bool resolved = true;
+  auto resolve = [handle, &resolved](const char* name, auto* function) {
+    if (!ResolveSymbol(handle, name, function)) {
+      LOG_ERROR("Fail to find %s in libdrmmanager.", name);
+      resolved = false;
+    }
+  };
+  resolve("DMGRSetData", &DMGRSetData);
+  resolve("DMGRGetData", &DMGRGetData);
+  resolve("DMGRSetDRMLocalMode", &DMGRSetDRMLocalMode);
+  resolve("DMGRCreateDRMSession", &DMGRCreateDRMSession);
+  resolve("DMGRSecurityInitCompleteCB", &DMGRSecurityInitCompleteCB);
+  resolve("DMGRReleaseDRMSession", &DMGRReleaseDRMSession);
+  return resolved ? DM_ERROR_NONE : DM_ERROR_DL;
 }
 
 void CloseDrmManagerProxy(void* handle) {
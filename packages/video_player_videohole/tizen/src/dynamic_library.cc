@@ -0,0 +1,27 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "dynamic_library.h"
+
+#include "log.h"
+
+DynamicLibrary::DynamicLibrary(const char *name) : name_(name) {
+  handle_ = dlopen(name, RTLD_LAZY);
+  if (!handle_) {
+    LOG_ERROR("Failed to open %s.", name);
+  }
+}
+
+DynamicLibrary::~DynamicLibrary() {
+  if (handle_) {
+    dlclose(handle_);
+    handle_ = nullptr;
+  }
+}
+
+void DynamicLibrary::ReportMissingSymbols() const {
+  for (const std::string &symbol : missing_symbols_) {
+    LOG_ERROR("Fail to find %s in %s.", symbol.c_str(), name_);
+  }
+}
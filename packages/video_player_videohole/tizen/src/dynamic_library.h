@@ -0,0 +1,79 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_DYNAMIC_LIBRARY_H_
+#define FLUTTER_PLUGIN_DYNAMIC_LIBRARY_H_
+
+#include <dlfcn.h>
+
+#include <string>
+#include <vector>
+
+// Resolves |name| from the library |handle| into |function|. Returns false
+// if the symbol is missing.
+template <typename T>
+bool ResolveSymbol(void *handle, const char *name, T *function) {
+  *function = handle ? reinterpret_cast<T>(dlsym(handle, name)) : nullptr;
+  return *function != nullptr;
+}
+
+// A library opened with dlopen() for the lifetime of this object.
+//
+// Symbols are resolved once through DynamicFunction members declared after
+// the library, and symbols that are missing are logged when the owner is
+// constructed rather than each time they are called.
+class DynamicLibrary {
+ public:
+  explicit DynamicLibrary(const char *name);
+  ~DynamicLibrary();
+
+  DynamicLibrary(const DynamicLibrary &) = delete;
+  DynamicLibrary &operator=(const DynamicLibrary &) = delete;
+
+  bool is_loaded() const { return handle_ != nullptr; }
+  const std::vector<std::string> &missing_symbols() const {
+    return missing_symbols_;
+  }
+
+  // Resolves |name| into |function|, recording it as missing on failure.
+  template <typename T>
+  bool Resolve(const char *name, T *function) {
+    if (ResolveSymbol(handle_, name, function)) {
+      return true;
+    }
+    if (handle_) {
+      missing_symbols_.push_back(name);
+    }
+    return false;
+  }
+
+  // Logs the symbols that could not be resolved, if any.
+  void ReportMissingSymbols() const;
+
+ private:
+  const char *name_;
+  void *handle_ = nullptr;
+  std::vector<std::string> missing_symbols_;
+};
+
+template <typename Signature>
+class DynamicFunction;
+
+// A function resolved from a DynamicLibrary at construction. Test it with
+// operator bool before calling it.
+template <typename R, typename... Args>
+class DynamicFunction<R(Args...)> {
+ public:
+  DynamicFunction(DynamicLibrary &library, const char *name) {
+    library.Resolve(name, &function_);
+  }
+
+  explicit operator bool() const { return function_ != nullptr; }
+  R operator()(Args... args) const { return function_(args...); }
+
+ private:
+  R (*function_)(Args...) = nullptr;
+};
+
+#endif  // FLUTTER_PLUGIN_DYNAMIC_LIBRARY_H_
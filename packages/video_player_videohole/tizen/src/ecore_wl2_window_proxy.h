@@ -5,15 +5,19 @@
 #ifndef FLUTTER_PLUGIN_ECORE_WL2_WINDOW_PROXY_H_
 #define FLUTTER_PLUGIN_ECORE_WL2_WINDOW_PROXY_H_
 
+#include "dynamic_library.h"
+
 class EcoreWl2WindowProxy {
  public:
   EcoreWl2WindowProxy();
-  ~EcoreWl2WindowProxy();
+  ~EcoreWl2WindowProxy() = default;
   void ecore_wl2_window_geometry_get(void *window, int *x, int *y, int *width,
                                      int *height);
 
  private:
-  void *ecore_wl2_window_handle_ = nullptr;
+  DynamicLibrary library_{"libecore_wl2.so.1"};
+  DynamicFunction<void(void *, int *, int *, int *, int *)>
+      ecore_wl2_window_geometry_get_{library_, "ecore_wl2_window_geometry_get"};
 };
 
 #endif  // FLUTTER_PLUGIN_ECORE_WL2_WINDOW_PROXY_H_
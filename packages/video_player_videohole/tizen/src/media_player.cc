@@ -12,6 +12,9 @@
 
 namespace video_player_videohole_tizen {
 
+// The display refresh interval of TVs (60 Hz).
+constexpr std::chrono::milliseconds kDisplayFrameInterval(16);
+
 static std::string RotationToString(player_display_rotation_e rotation) {
   switch (rotation) {
     case PLAYER_DISPLAY_ROTATION_NONE:
@@ -47,6 +50,7 @@ MediaPlayer::MediaPlayer(flutter::BinaryMessenger *messenger,
 }
 
 MediaPlayer::~MediaPlayer() {
+  CancelDisplayRoiUpdate();
   if (player_) {
     player_stop(player_);
     player_unprepare(player_);
@@ -118,8 +122,9 @@ int64_t MediaPlayer::Create(const std::string &uri,
     return -1;
   }
 
-  SetDisplayRoi(pre_display_roi_x_, pre_display_roi_y_, pre_display_roi_width_,
-                pre_display_roi_height_);
+  CancelDisplayRoiUpdate();
+  applied_display_roi_.reset();
+  ApplyDisplayRoi();
 
   ret = player_set_uri(player_, uri.c_str());
   if (ret != PLAYER_ERROR_NONE) {
@@ -187,15 +192,58 @@ void MediaPlayer::Dispose() {
 
 void MediaPlayer::SetDisplayRoi(int32_t x, int32_t y, int32_t width,
                                 int32_t height) {
-  int ret = player_set_display_roi_area(player_, x, y, width, height);
+  pending_display_roi_ = {x, y, width, height};
+  if (display_roi_source_) {
+    // The scheduled update applies the latest geometry.
+    return;
+  }
+  auto elapsed = std::chrono::steady_clock::now() - last_display_roi_update_;
+  if (elapsed >= kDisplayFrameInterval) {
+    ApplyDisplayRoi();
+    return;
+  }
+
+  // Defer the update to the next frame, so that a scrolling video sends at
+  // most one update per frame to the media service.
+  auto delay = std::chrono::ceil<std::chrono::milliseconds>(
+      kDisplayFrameInterval - elapsed);
+  display_roi_source_ = g_timeout_source_new(delay.count());
+  g_source_set_callback(display_roi_source_, OnDisplayRoiFrame, this, nullptr);
+  GMainContext *context = g_main_context_ref_thread_default();
+  g_source_attach(display_roi_source_, context);
+  g_main_context_unref(context);
+}
+
+gboolean MediaPlayer::OnDisplayRoiFrame(gpointer user_data) {
+  MediaPlayer *self = static_cast<MediaPlayer *>(user_data);
+  g_source_unref(self->display_roi_source_);
+  self->display_roi_source_ = nullptr;
+  self->ApplyDisplayRoi();
+  return G_SOURCE_REMOVE;
+}
+
+void MediaPlayer::CancelDisplayRoiUpdate() {
+  if (display_roi_source_) {
+    g_source_destroy(display_roi_source_);
+    g_source_unref(display_roi_source_);
+    display_roi_source_ = nullptr;
+  }
+}
+
+void MediaPlayer::ApplyDisplayRoi() {
+  if (!player_ || applied_display_roi_ == pending_display_roi_) {
+    return;
+  }
+  const DisplayRoi &roi = pending_display_roi_;
+  int ret = player_set_display_roi_area(player_, roi.x, roi.y, roi.width,
+                                        roi.height);
   if (ret != PLAYER_ERROR_NONE) {
     LOG_ERROR("[MediaPlayer] player_set_display_roi_area failed: %s.",
               get_error_message(ret));
+    return;
   }
-  pre_display_roi_x_ = x;
-  pre_display_roi_y_ = y;
-  pre_display_roi_width_ = width;
-  pre_display_roi_height_ = height;
+  applied_display_roi_ = roi;
+  last_display_roi_update_ = std::chrono::steady_clock::now();
 }
 
 bool MediaPlayer::Play() {
@@ -300,6 +348,10 @@ bool MediaPlayer::SeekTo(int64_t position, SeekCompletedCallback callback) {
 }
 
 int64_t MediaPlayer::GetPosition() {
+  if (!player_) {
+    // Released by MultiviewManager.
+    return pre_playing_time_;
+  }
   int position = 0;
   int ret = player_get_play_position(player_, &position);
   if (ret != PLAYER_ERROR_NONE) {
@@ -437,6 +489,11 @@ std::pair<int64_t, int64_t> MediaPlayer::GetLiveDuration() {
 }
 
 flutter::EncodableList MediaPlayer::GetTrackInfo(std::string track_type) {
+  if (!media_player_proxy_->SupportsTrackInfoV2()) {
+    LOG_ERROR("[MediaPlayer] Track information is not supported.");
+    return {};
+  }
+
   player_state_e state = PLAYER_STATE_NONE;
   int ret = player_get_state(player_, &state);
   if (ret != PLAYER_ERROR_NONE) {
@@ -687,8 +744,7 @@ bool MediaPlayer::StopAndDestroy() {
   return true;
 }
 
-bool MediaPlayer::Suspend() {
-  LOG_INFO("[MediaPlayer] Suspend is called.");
+bool MediaPlayer::SavePlayerState() {
   if (!player_) {
     LOG_ERROR("[MediaPlayer] Player not created.");
     return false;
@@ -711,6 +767,14 @@ bool MediaPlayer::Suspend() {
   LOG_INFO(
       "[MediaPlayer] Saved current player state: %d, playing time: %llu ms",
       pre_state_, pre_playing_time_);
+  return true;
+}
+
+bool MediaPlayer::Suspend() {
+  LOG_INFO("[MediaPlayer] Suspend is called.");
+  if (!SavePlayerState()) {
+    return false;
+  }
 
   if (IsLive()) {
     pre_playing_time_ = 0;
@@ -722,7 +786,7 @@ bool MediaPlayer::Suspend() {
     return true;
   }
 
-  res = device_proxy_->device_power_get_state();
+  int res = device_proxy_->device_power_get_state();
   if (res == POWER_STATE_STANDBY) {
     LOG_INFO("[MediaPlayer] Power state is standby.");
     if (!StopAndDestroy()) {
@@ -735,13 +799,13 @@ bool MediaPlayer::Suspend() {
     LOG_INFO("[MediaPlayer] Player state is not standby: %d, do nothing.", res);
   }
 
-  if (player_state == PLAYER_STATE_IDLE) {
+  if (pre_state_ == PLAYER_STATE_IDLE) {
     if (!StopAndDestroy()) {
       LOG_ERROR("[MediaPlayer] Player StopAndDestroy fail.");
       return false;
     }
     LOG_INFO("[MediaPlayer] Player called in IDLE state, so stop the player.");
-  } else if (player_state != PLAYER_STATE_PAUSED) {
+  } else if (pre_state_ != PLAYER_STATE_PAUSED) {
     LOG_INFO("[MediaPlayer] Player calling pause from suspend.");
     if (!Pause()) {
       LOG_ERROR(
@@ -852,6 +916,59 @@ bool MediaPlayer::SetDisplayRotate(int64_t rotation) {
   return true;
 }
 
+void MediaPlayer::FlushDisplayRoi() {
+  CancelDisplayRoiUpdate();
+  ApplyDisplayRoi();
+}
+
+bool MediaPlayer::Release() {
+  LOG_INFO("[MediaPlayer] Release is called.");
+  if (!SavePlayerState()) {
+    return false;
+  }
+  // StopAndDestroy() keeps players that are not prepared yet.
+  if (pre_state_ == PLAYER_STATE_IDLE) {
+    LOG_ERROR("[MediaPlayer] Player not prepared, cannot be released.");
+    return false;
+  }
+  if (IsLive()) {
+    pre_playing_time_ = 0;
+  }
+  return StopAndDestroy();
+}
+
+bool MediaPlayer::SetDisplayVisible(bool visible) {
+  int ret = player_set_display_visible(player_, visible);
+  if (ret != PLAYER_ERROR_NONE) {
+    LOG_ERROR("[MediaPlayer] player_set_display_visible failed: %s",
+              get_error_message(ret));
+    return false;
+  }
+  return true;
+}
+
+bool MediaPlayer::IsPlaying() {
+  player_state_e state = PLAYER_STATE_NONE;
+  int ret = player_get_state(player_, &state);
+  if (ret != PLAYER_ERROR_NONE) {
+    LOG_ERROR("[MediaPlayer] player_get_state failed: %s.",
+              get_error_message(ret));
+    return false;
+  }
+  return state == PLAYER_STATE_PLAYING;
+}
+
+bool MediaPlayer::SetMaxVideoResolution(int32_t width, int32_t height) {
+  LOG_INFO("[MediaPlayer] Max video resolution: %d x %d", width, height);
+  int ret = player_set_max_adaptive_variant_limit(player_, -1, width, height);
+  if (ret != PLAYER_ERROR_NONE) {
+    LOG_ERROR("[MediaPlayer] player_set_max_adaptive_variant_limit failed: %s",
+              get_error_message(ret));
+    return false;
+  }
+  return true;
+}
+
 void MediaPlayer::OnRestoreCompleted() {
   if (pre_playing_time_ <= 0 ||
       !SeekTo(pre_playing_time_, [this]() { SendRestored(); })) {
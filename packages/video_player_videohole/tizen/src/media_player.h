@@ -6,8 +6,11 @@
 #define FLUTTER_PLUGIN_MEDIA_PLAYER_H_
 
 #include <flutter/plugin_registrar.h>
+#include <glib.h>
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -46,14 +49,38 @@ class MediaPlayer : public VideoPlayer {
   bool Restore(const CreateMessage *restore_message,
                int64_t resume_time) override;
   bool SetDisplayRotate(int64_t rotation) override;
+  void FlushDisplayRoi() override;
+  bool Release() override;
+  bool SetDisplayVisible(bool visible) override;
+  bool IsPlaying() override;
+  bool SetMaxVideoResolution(int32_t width, int32_t height) override;
 
  private:
+  struct DisplayRoi {
+    int32_t x = 0;
+    int32_t y = 0;
+    int32_t width = 1;
+    int32_t height = 1;
+
+    bool operator==(const DisplayRoi &other) const {
+      return x == other.x && y == other.y && width == other.width &&
+             height == other.height;
+    }
+  };
+
+  // Applies the pending display ROI unless it is already applied.
+  void ApplyDisplayRoi();
+  void CancelDisplayRoiUpdate();
+  static gboolean OnDisplayRoiFrame(gpointer user_data);
+
   std::pair<int64_t, int64_t> GetLiveDuration();
   bool IsLive();
   bool SetDisplay();
   bool SetDrm(const std::string &uri, int drm_type,
               const std::string &license_server_url);
   bool StopAndDestroy();
+  // Saves the state and position of the player for Restore().
+  bool SavePlayerState();
   bool RestorePlayer(const CreateMessage *restore_message, int64_t resume_time);
   void OnRestoreCompleted();
 
@@ -79,12 +106,14 @@ class MediaPlayer : public VideoPlayer {
   std::unique_ptr<DeviceProxy> device_proxy_ = nullptr;
   std::string url_;
   CreateMessage create_message_;
-  player_state_e pre_state_;
-  int64_t pre_playing_time_;
-  int32_t pre_display_roi_x_ = 0;
-  int32_t pre_display_roi_y_ = 0;
-  int32_t pre_display_roi_width_ = 1;
-  int32_t pre_display_roi_height_ = 1;
+  player_state_e pre_state_ = PLAYER_STATE_NONE;
+  int64_t pre_playing_time_ = 0;
+  // The latest geometry requested by SetDisplayRoi and the one last applied
+  // to the player. Updates are applied at most once per display frame.
+  DisplayRoi pending_display_roi_;
+  std::optional<DisplayRoi> applied_display_roi_;
+  std::chrono::steady_clock::time_point last_display_roi_update_;
+  GSource *display_roi_source_ = nullptr;
 };
 
 }  // namespace video_player_videohole_tizen
@@ -7,6 +7,8 @@
 
 #include <player.h>
 
+#include "dynamic_library.h"
+
 #define MAX_STRING_NAME_LEN 255
 #define MMPLAYER_FOUR_CC_LEN 14
 #define PLAYER_LANG_NAME_SIZE 10
@@ -108,7 +110,7 @@ typedef int (*set_drm_init_data_cb)(drm_init_data_type init_type, void* data,
 class MediaPlayerProxy {
  public:
   MediaPlayerProxy();
-  ~MediaPlayerProxy();
+  ~MediaPlayerProxy() = default;
   int player_set_ecore_wl_display(player_h player, player_display_type_e type,
                                   void* ecore_wl_window, int x, int y,
                                   int width, int height);
@@ -131,8 +133,41 @@ class MediaPlayerProxy {
   int player_get_subtitle_track_info_v2(
       player_h player, int index, player_subtitle_track_info_v2** track_info);
 
+  // Whether the v2 track information APIs are available.
+  bool SupportsTrackInfoV2() const {
+    return player_get_track_count_v2_ && player_get_video_track_info_v2_ &&
+           player_get_audio_track_info_v2_ &&
+           player_get_subtitle_track_info_v2_;
+  }
+
  private:
-  void* media_player_handle_ = nullptr;
+  // Must be declared before the functions resolved from it.
+  DynamicLibrary library_{"libcapi-media-player.so.0"};
+
+  DynamicFunction<int(player_h, player_display_type_e, void*, int, int, int,
+                      int)>
+      player_set_ecore_wl_display_{library_, "player_set_ecore_wl_display"};
+  DynamicFunction<int(player_h, player_drm_type_e, int)>
+      player_set_drm_handle_{library_, "player_set_drm_handle"};
+  DynamicFunction<int(player_h, security_init_complete_cb, void*)>
+      player_set_drm_init_complete_cb_{library_,
+                                       "player_set_drm_init_complete_cb"};
+  DynamicFunction<int(player_h, set_drm_init_data_cb, void*)>
+      player_set_drm_init_data_cb_{library_, "player_set_drm_init_data_cb"};
+  DynamicFunction<int(player_h, void*, int)>
+      player_get_adaptive_streaming_info_{
+          library_, "player_get_adaptive_streaming_info"};
+  DynamicFunction<int(player_h, player_stream_type_e, int*)>
+      player_get_track_count_v2_{library_, "player_get_track_count_v2"};
+  DynamicFunction<int(player_h, int, player_video_track_info_v2**)>
+      player_get_video_track_info_v2_{library_,
+                                      "player_get_video_track_info_v2"};
+  DynamicFunction<int(player_h, int, player_audio_track_info_v2**)>
+      player_get_audio_track_info_v2_{library_,
+                                      "player_get_audio_track_info_v2"};
+  DynamicFunction<int(player_h, int, player_subtitle_track_info_v2**)>
+      player_get_subtitle_track_info_v2_{library_,
+                                         "player_get_subtitle_track_info_v2"};
 };
 
 #endif  // FLUTTER_PLUGIN_MEDIA_PLAYER_PROXY_H_
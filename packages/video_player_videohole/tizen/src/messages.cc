@@ -1458,6 +1458,41 @@ void VideoPlayerVideoholeApi::SetUp(flutter::BinaryMessenger* binary_messenger,
       channel->SetMessageHandler(nullptr);
     }
   }
+  {
+    auto channel = std::make_unique<BasicMessageChannel<>>(
+        binary_messenger,
+        "dev.flutter.pigeon.video_player_videohole.VideoPlayerVideoholeApi."
+        "setMultiviewLayout",
+        &GetCodec());
+    if (api != nullptr) {
+      channel->SetMessageHandler(
+          [api](const EncodableValue& message,
+                const flutter::MessageReply<EncodableValue>& reply) {
+            try {
+              const auto& args = std::get<EncodableList>(message);
+              const auto& encodable_geometries_arg = args.at(0);
+              if (encodable_geometries_arg.IsNull()) {
+                reply(WrapError("geometries_arg unexpectedly null."));
+                return;
+              }
+              const auto& geometries_arg =
+                  std::get<EncodableList>(encodable_geometries_arg);
+              ErrorOr<bool> output = api->SetMultiviewLayout(geometries_arg);
+              if (output.has_error()) {
+                reply(WrapError(output.error()));
+                return;
+              }
+              EncodableList wrapped;
+              wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+              reply(EncodableValue(std::move(wrapped)));
+            } catch (const std::exception& exception) {
+              reply(WrapError(exception.what()));
+            }
+          });
+    } else {
+      channel->SetMessageHandler(nullptr);
+    }
+  }
 }
 
 EncodableValue VideoPlayerVideoholeApi::WrapError(
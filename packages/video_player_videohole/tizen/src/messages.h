@@ -433,6 +433,8 @@ class VideoPlayerVideoholeApi {
                                               const CreateMessage* msg,
                                               int64_t resume_time) = 0;
   virtual ErrorOr<bool> SetDisplayRotate(const RotationMessage& msg) = 0;
+  virtual ErrorOr<bool> SetMultiviewLayout(
+      const flutter::EncodableList& geometries) = 0;
 
   // The codec used by VideoPlayerVideoholeApi.
   static const flutter::StandardMessageCodec& GetCodec();
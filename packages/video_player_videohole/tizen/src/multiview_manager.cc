@@ -0,0 +1,177 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "multiview_manager.h"
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+
+#include "log.h"
+
+namespace video_player_videohole_tizen {
+
+MultiviewManager::MultiviewManager(PlayerFinder player_finder,
+                                   size_t max_decoders)
+    : player_finder_(std::move(player_finder)), max_decoders_(max_decoders) {}
+
+bool MultiviewManager::SetLayout(const std::vector<Window> &windows) {
+  for (const Window &window : windows) {
+    if (!player_finder_(window.player_id)) {
+      LOG_ERROR("[MultiviewManager] Player %lld not found.", window.player_id);
+      return false;
+    }
+  }
+
+  if (windows.empty()) {
+    for (auto &[player_id, state] : players_) {
+      VideoPlayer *player = player_finder_(player_id);
+      if (player) {
+        Show(player, state);
+        SetMaxVideoResolution(player, state, -1, -1);
+      }
+    }
+    players_.clear();
+    return true;
+  }
+
+  // Rank the windows by area. Ties keep the later window first.
+  std::vector<size_t> ranking(windows.size());
+  std::iota(ranking.rbegin(), ranking.rend(), 0);
+  std::stable_sort(ranking.begin(), ranking.end(), [&](size_t a, size_t b) {
+    return static_cast<int64_t>(windows[a].width) * windows[a].height >
+           static_cast<int64_t>(windows[b].width) * windows[b].height;
+  });
+  std::set<int64_t> decoding;
+  for (size_t i = 0; i < ranking.size() && i < max_decoders_; i++) {
+    decoding.insert(windows[ranking[i]].player_id);
+  }
+  int64_t primary_player_id = windows[ranking[0]].player_id;
+
+  // Hide players first, so that they do not show through the players shown
+  // in their place.
+  for (const Window &window : windows) {
+    players_.try_emplace(window.player_id);
+  }
+  for (auto iter = players_.begin(); iter != players_.end();) {
+    VideoPlayer *player = player_finder_(iter->first);
+    if (!player) {
+      iter = players_.erase(iter);
+      continue;
+    }
+    if (decoding.find(iter->first) == decoding.end()) {
+      Hide(player, iter->second);
+    }
+    ++iter;
+  }
+
+  for (const Window &window : windows) {
+    if (decoding.find(window.player_id) == decoding.end()) {
+      continue;
+    }
+    VideoPlayer *player = player_finder_(window.player_id);
+    PlayerState &state = players_[window.player_id];
+    // A released player is recreated by Show(), so it is restored first.
+    Show(player, state);
+    player->SetDisplayRoi(window.x, window.y, window.width, window.height);
+    player->FlushDisplayRoi();
+    if (window.player_id == primary_player_id) {
+      SetMaxVideoResolution(player, state, -1, -1);
+    } else {
+      SetMaxVideoResolution(player, state, window.width, window.height);
+    }
+  }
+  return true;
+}
+
+bool MultiviewManager::OnPauseRequested(int64_t player_id) {
+  auto iter = players_.find(player_id);
+  if (iter == players_.end() || !iter->second.paused) {
+    return false;
+  }
+  iter->second.paused = false;
+  return true;
+}
+
+bool MultiviewManager::OnPlayRequested(int64_t player_id) {
+  auto iter = players_.find(player_id);
+  if (iter == players_.end()) {
+    return false;
+  }
+  iter->second.paused = iter->second.released;
+  return iter->second.released;
+}
+
+void MultiviewManager::RemovePlayer(int64_t player_id) {
+  players_.erase(player_id);
+}
+
+void MultiviewManager::Clear() { players_.clear(); }
+
+void MultiviewManager::Hide(VideoPlayer *player, PlayerState &state) {
+  if (state.released) {
+    return;
+  }
+  if (state.visible) {
+    player->SetDisplayVisible(false);
+    state.visible = false;
+  }
+  // Pause() reports the new state to Dart, so that the controller of a
+  // hidden player is not left playing.
+  if (player->IsPlaying() && player->Pause()) {
+    state.paused = true;
+  }
+  // Releasing the player frees its decoder for the players being shown. A
+  // player that cannot be released stays paused instead.
+  if (player->Release()) {
+    state.released = true;
+  }
+}
+
+void MultiviewManager::Show(VideoPlayer *player, PlayerState &state) {
+  if (state.released) {
+    // Recreates the player at the saved position with the last data source.
+    // The new player is visible and has no resolution limit.
+    CreateMessage restore_message;
+    if (!player->Restore(&restore_message, -1)) {
+      LOG_ERROR("[MultiviewManager] Fail to restore the player.");
+      return;
+    }
+    state.released = false;
+    state.visible = true;
+    state.max_width = -1;
+    state.max_height = -1;
+    // The controller plays the player once it receives the restored event,
+    // if it is reported as playing.
+    if (state.paused) {
+      player->SendIsPlayingState(true);
+      state.paused = false;
+    }
+    return;
+  }
+  if (!state.visible) {
+    player->SetDisplayVisible(true);
+    state.visible = true;
+  }
+  // |paused| is cleared if the app paused or played the player while it was
+  // hidden.
+  if (state.paused) {
+    player->Play();
+    state.paused = false;
+  }
+}
+
+void MultiviewManager::SetMaxVideoResolution(VideoPlayer *player,
+                                             PlayerState &state, int32_t width,
+                                             int32_t height) {
+  if (state.max_width == width && state.max_height == height) {
+    return;
+  }
+  // The limit has no effect on non-adaptive streams, which is not an error.
+  player->SetMaxVideoResolution(width, height);
+  state.max_width = width;
+  state.max_height = height;
+}
+
+}  // namespace video_player_videohole_tizen
@@ -0,0 +1,91 @@
+// Copyright 2026 Samsung Electronics Co., Ltd. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_PLUGIN_MULTIVIEW_MANAGER_H_
+#define FLUTTER_PLUGIN_MULTIVIEW_MANAGER_H_
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <vector>
+
+#include "video_player.h"
+
+namespace video_player_videohole_tizen {
+
+// Coordinates players that are shown together, such as a main video with a
+// picture-in-picture preview, so that they stay within the number of hardware
+// video decoders.
+//
+// The players of a layout are ranked by display area. The largest one is the
+// primary player and plays at full resolution. The following ones, up to the
+// number of decoders, are secondary players limited to variants no larger
+// than their display area. The remaining players, and players removed from
+// the layout, are paused and released, which frees their decoders, and are
+// recreated where they left off when they are shown again.
+//
+// Windows should not overlap, because the stacking order of video planes
+// cannot be controlled.
+class MultiviewManager {
+ public:
+  // TVs have a main and a sub video decoder.
+  static constexpr size_t kDefaultMaxDecoders = 2;
+
+  struct Window {
+    int64_t player_id;
+    int32_t x;
+    int32_t y;
+    int32_t width;
+    int32_t height;
+  };
+
+  using PlayerFinder = std::function<VideoPlayer *(int64_t player_id)>;
+
+  explicit MultiviewManager(PlayerFinder player_finder,
+                            size_t max_decoders = kDefaultMaxDecoders);
+
+  // Shows |windows| and hides the players of the previous layout that are
+  // not in |windows|, in a single update. Of windows with the same area, the
+  // later one ranks higher. An empty layout ends the multiview and restores
+  // every player. Returns false without changing any player if a player is
+  // not found.
+  bool SetLayout(const std::vector<Window> &windows);
+
+  // Called when the app pauses |player_id|. Returns true if the player is
+  // already paused because it is hidden, in which case it is no longer
+  // resumed when shown.
+  bool OnPauseRequested(int64_t player_id);
+  // Called when the app plays |player_id|, which then no longer needs to be
+  // resumed when shown. Returns true if the player is released because it is
+  // hidden, in which case it plays once shown.
+  bool OnPlayRequested(int64_t player_id);
+
+  void RemovePlayer(int64_t player_id);
+  void Clear();
+
+ private:
+  struct PlayerState {
+    bool visible = true;
+    // Whether the player resumes when shown, because it was paused by the
+    // manager or played by the app while released.
+    bool paused = false;
+    // Whether the player was released by Hide() and must be restored.
+    bool released = false;
+    int32_t max_width = -1;
+    int32_t max_height = -1;
+  };
+
+  void Hide(VideoPlayer *player, PlayerState &state);
+  void Show(VideoPlayer *player, PlayerState &state);
+  void SetMaxVideoResolution(VideoPlayer *player, PlayerState &state,
+                             int32_t width, int32_t height);
+
+  PlayerFinder player_finder_;
+  size_t max_decoders_;
+  std::map<int64_t, PlayerState> players_;
+};
+
+}  // namespace video_player_videohole_tizen
+
+#endif  // FLUTTER_PLUGIN_MULTIVIEW_MANAGER_H_
@@ -37,6 +37,8 @@ class VideoPlayer {
 
   virtual void SetDisplayRoi(int32_t x, int32_t y, int32_t width,
                              int32_t height) = 0;
+  // Play() and Pause() send an isPlayingStateUpdate event on success, also
+  // when called by MultiviewManager rather than by the app.
   virtual bool Play() = 0;
   virtual bool Deactivate() { return false; };
   virtual bool Activate() { return false; };
@@ -55,6 +57,19 @@ class VideoPlayer {
                        int64_t resume_time) = 0;
   virtual bool SetDisplayRotate(int64_t rotation) = 0;
 
+  // Used by MultiviewManager.
+  virtual void FlushDisplayRoi() = 0;
+  // Releases the player, including its video decoder, after saving its state
+  // so that Restore() recreates it where it left off.
+  virtual bool Release() = 0;
+  // Reports |is_playing| to the controller without changing the player.
+  void SendIsPlayingState(bool is_playing);
+  virtual bool SetDisplayVisible(bool visible) = 0;
+  virtual bool IsPlaying() = 0;
+  // Limits adaptive streams to variants no larger than |width| x |height|.
+  // -1 removes the limit.
+  virtual bool SetMaxVideoResolution(int32_t width, int32_t height) = 0;
+
  protected:
   virtual void GetVideoSize(int32_t *width, int32_t *height) = 0;
   void *GetWindowHandle();
@@ -66,7 +81,6 @@ class VideoPlayer {
   void SendBufferingEnd();
   void SendSubtitleUpdate(int32_t duration, const std::string &text);
   void SendPlayCompleted();
-  void SendIsPlayingState(bool is_playing);
   void SendRestored();
   void SendError(const std::string &error_code,
                  const std::string &error_message);
@@ -9,14 +9,17 @@
 #include <flutter/plugin_registrar.h>
 #include <flutter_tizen.h>
 
+#include <any>
 #include <cstdint>
 #include <map>
 #include <optional>
 #include <string>
 #include <variant>
+#include <vector>
 
 #include "media_player.h"
 #include "messages.h"
+#include "multiview_manager.h"
 #include "video_player.h"
 #include "video_player_options.h"
 
@@ -60,6 +63,8 @@ class VideoPlayerTizenPlugin : public flutter::Plugin,
                                       const CreateMessage *msg,
                                       int64_t resume_time) override;
   ErrorOr<bool> SetDisplayRotate(const RotationMessage &msg) override;
+  ErrorOr<bool> SetMultiviewLayout(
+      const flutter::EncodableList &geometries) override;
 
   static VideoPlayer *FindPlayerById(int64_t player_id) {
     auto iter = players_.find(player_id);
@@ -80,6 +85,7 @@ class VideoPlayerTizenPlugin : public flutter::Plugin,
   FlutterDesktopPluginRegistrarRef registrar_ref_;
   flutter::PluginRegistrar *plugin_registrar_;
   VideoPlayerOptions options_;
+  MultiviewManager multiview_manager_{FindPlayerById};
 
   static inline std::map<int64_t, std::unique_ptr<VideoPlayer>> players_;
 };
@@ -106,6 +112,7 @@ void VideoPlayerTizenPlugin::DisposeAllPlayers() {
     player->Dispose();
   }
   players_.clear();
+  multiview_manager_.Clear();
 }
 
 std::optional<FlutterError> VideoPlayerTizenPlugin::Initialize() {
@@ -167,6 +174,7 @@ std::optional<FlutterError> VideoPlayerTizenPlugin::Dispose(
   if (iter != players_.end()) {
     iter->second->Dispose();
     players_.erase(iter);
+    multiview_manager_.RemovePlayer(msg.player_id());
   }
   return std::nullopt;
 }
@@ -234,6 +242,10 @@ std::optional<FlutterError> VideoPlayerTizenPlugin::Play(
   if (!player) {
     return FlutterError("Invalid argument", "Player not found");
   }
+  // A player released by the multiview layout plays once it is shown.
+  if (multiview_manager_.OnPlayRequested(msg.player_id())) {
+    return std::nullopt;
+  }
   if (!player->Play()) {
     return FlutterError("Play", "Player play failed");
   }
@@ -262,6 +274,10 @@ std::optional<FlutterError> VideoPlayerTizenPlugin::Pause(
   if (!player) {
     return FlutterError("Invalid argument", "Player not found");
   }
+  // A player hidden by the multiview layout is already paused.
+  if (multiview_manager_.OnPauseRequested(msg.player_id())) {
+    return std::nullopt;
+  }
   if (!player->Pause()) {
     return FlutterError("Pause", "Player pause failed");
   }
@@ -340,6 +356,23 @@ ErrorOr<bool> VideoPlayerTizenPlugin::SetDisplayRotate(
   return player->SetDisplayRotate(msg.rotation());
 }
 
+ErrorOr<bool> VideoPlayerTizenPlugin::SetMultiviewLayout(
+    const flutter::EncodableList &geometries) {
+  std::vector<MultiviewManager::Window> windows;
+  for (const flutter::EncodableValue &value : geometries) {
+    const auto *geometry = std::get_if<flutter::CustomEncodableValue>(&value);
+    if (!geometry) {
+      return FlutterError("Invalid argument", "Geometry must not be null");
+    }
+    const auto &msg = std::any_cast<const GeometryMessage &>(*geometry);
+    windows.push_back({msg.player_id(), static_cast<int32_t>(msg.x()),
+                       static_cast<int32_t>(msg.y()),
+                       static_cast<int32_t>(msg.width()),
+                       static_cast<int32_t>(msg.height())});
+  }
+  return multiview_manager_.SetLayout(windows);
+}
+
 }  // namespace video_player_videohole_tizen
 
 void VideoPlayerTizenPluginRegisterWithRegistrar(